@@ -174,6 +174,17 @@ class Ball : public Serializable
      */
     inline void tick(bool isReceivingRegularClock = true);
 
+    /**
+      Number of clocks (at most limit) before the ball starts drawing. Over these,
+      tick() only advances the counter, so tickIdle() can skip them at once.
+     */
+    inline uInt32 idleClocks(uInt32 limit) const;
+
+    /**
+      Equivalent to calling tick() for the given number of idle clocks.
+     */
+    inline void tickIdle(uInt32 clocks);
+
   public:
 
     /**
@@ -412,4 +423,20 @@ void Ball::tick(bool isReceivingRegularClock)
       myCounter = 0;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 Ball::idleClocks(uInt32 limit) const
+{
+  if (myIsRendering || (myUseInvertedPhaseClock && myInvertedPhaseClock)) return 0;
+
+  return std::min<uInt32>(limit, (156 + TIAConstants::H_PIXEL - myCounter) % TIAConstants::H_PIXEL);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Ball::tickIdle(uInt32 clocks)
+{
+  mySignalActive = false;
+  collision = myCollisionMaskDisabled;
+  myCounter = (myCounter + clocks) % TIAConstants::H_PIXEL;
+}
+
 #endif // TIA_BALL
@@ -43,6 +43,16 @@ class DelayQueue : public Serializable
 
     template<typename T> void execute(T executor);
 
+    /**
+      True if no writes are pending, so execute() would only advance the queue.
+    */
+    bool isEmpty() const { return myPendingCount == 0; }
+
+    /**
+      Equivalent to executing an empty queue for the given number of clocks.
+    */
+    void skip(uInt32 clocks);
+
     /**
       Serializable methods (see that class for more information).
     */
@@ -53,6 +63,7 @@ class DelayQueue : public Serializable
     std::array<DelayQueueMember<capacity>, length> myMembers;
     uInt8 myIndex{0};
     std::array<uInt8, 0xFF> myIndices;
+    uInt32 myPendingCount{0};
 
   private:
     DelayQueue(const DelayQueue&) = delete;
@@ -81,11 +92,14 @@ void DelayQueue<length, capacity>::push(uInt8 address, uInt8 value, uInt8 delay)
 
   const uInt8 currentIndex = myIndices[address];
 
-  if (currentIndex < length)
+  if (currentIndex < length) {
     myMembers[currentIndex].remove(address);
+    --myPendingCount;
+  }
 
   const uInt8 index = smartmod<length>(myIndex + delay);
   myMembers[index].push(address, value);
+  ++myPendingCount;
 
   myIndices[address] = index;
 }
@@ -99,6 +113,7 @@ void DelayQueue<length, capacity>::reset()
 
   myIndex = 0;
   myIndices.fill(0xFF);
+  myPendingCount = 0;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -113,11 +128,19 @@ void DelayQueue<length, capacity>::execute(T executor)
     myIndices[currentMember.myEntries[i].address] = 0xFF;
   }
 
+  myPendingCount -= currentMember.mySize;
   currentMember.clear();
 
   myIndex = smartmod<length>(myIndex + 1);
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+template<unsigned length, unsigned capacity>
+void DelayQueue<length, capacity>::skip(uInt32 clocks)
+{
+  myIndex = (myIndex + clocks) % length;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 template<unsigned length, unsigned capacity>
 bool DelayQueue<length, capacity>::save(Serializer& out) const
@@ -154,6 +177,10 @@ bool DelayQueue<length, capacity>::load(Serializer& in)
 
     myIndex = in.getByte();
     in.getByteArray(myIndices.data(), myIndices.size());
+
+    myPendingCount = 0;
+    for (uInt32 i = 0; i < length; ++i)
+      myPendingCount += myMembers[i].mySize;
   }
   catch(...)
   {
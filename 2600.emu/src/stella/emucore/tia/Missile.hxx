@@ -80,6 +80,10 @@ class Missile : public Serializable
 
     inline void tick(uInt8 hclock, bool isReceivingMclock = true);
 
+    inline uInt32 idleClocks(uInt32 limit) const;
+
+    inline void tickIdle(uInt32 clocks);
+
   public:
 
     uInt32 collision{0};
@@ -200,4 +204,27 @@ void Missile::tick(uInt8 hclock, bool isReceivingMclock)
   if (++myCounter >= TIAConstants::H_PIXEL) myCounter = 0;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 Missile::idleClocks(uInt32 limit) const
+{
+  // Clocks until a copy starts drawing, during which tick() only advances the counter
+  if (myIsRendering || (myUseInvertedPhaseClock && myInvertedPhaseClock)) return 0;
+  if (myResmp) return limit;
+
+  // Copies can only start at these counter values (see DrawCounterDecodes)
+  for (uInt32 start: {12, 28, 60, 156})
+    if (myDecodes[start])
+      limit = std::min<uInt32>(limit, (start + TIAConstants::H_PIXEL - myCounter) % TIAConstants::H_PIXEL);
+
+  return limit;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Missile::tickIdle(uInt32 clocks)
+{
+  myIsVisible = false;
+  collision = myCollisionMaskDisabled;
+  myCounter = (myCounter + clocks) % TIAConstants::H_PIXEL;
+}
+
 #endif // TIA_MISSILE
@@ -91,6 +91,10 @@ class Player : public Serializable
 
     inline void tick();
 
+    inline uInt32 idleClocks(uInt32 limit) const;
+
+    inline void tickIdle(uInt32 clocks);
+
   public:
 
     uInt32 collision{0};
@@ -217,4 +221,25 @@ void Player::tick()
   if (++myCounter >= TIAConstants::H_PIXEL) myCounter = 0;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 Player::idleClocks(uInt32 limit) const
+{
+  // Clocks until a copy starts drawing, during which tick() only advances the counter
+  if (myIsRendering || (myUseInvertedPhaseClock && myInvertedPhaseClock)) return 0;
+
+  // Copies can only start at these counter values (see DrawCounterDecodes)
+  for (uInt32 start: {12, 28, 60, 156})
+    if (myDecodes[start])
+      limit = std::min<uInt32>(limit, (start + TIAConstants::H_PIXEL - myCounter) % TIAConstants::H_PIXEL);
+
+  return limit;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Player::tickIdle(uInt32 clocks)
+{
+  collision = myCollisionMaskDisabled;
+  myCounter = (myCounter + clocks) % TIAConstants::H_PIXEL;
+}
+
 #endif // TIA_PLAYER
@@ -1417,6 +1417,28 @@ void TIA::cycle(uInt32 colorClocks)
 {
   for (uInt32 i = 0; i < colorClocks; ++i)
   {
+    // Registers are only written by the CPU in between calls, so with no delayed
+    // writes or HMOVE pending nothing can change for the rest of the visible
+    // scanline and it can be advanced without the per-clock checks. The last clock
+    // of the line is left to the regular path, which handles nextLine().
+    if (myHstate == HState::frame && myLinesSinceChange < 2 &&
+        !myMovementInProgress && myDelayQueue.isEmpty())
+    {
+      const uInt32 spanClocks = std::min<uInt32>(colorClocks - i, TIAConstants::H_CLOCKS - 1 - myHctr);
+
+      if (spanClocks > 1) {
+        switch (myPriority)
+        {
+          case Priority::pfp:    tickHframeSpan<Priority::pfp>(spanClocks);    break;
+          case Priority::score:  tickHframeSpan<Priority::score>(spanClocks);  break;
+          case Priority::normal: tickHframeSpan<Priority::normal>(spanClocks); break;
+        }
+
+        i += spanClocks - 1;
+        continue;
+      }
+    }
+
     myDelayQueue.execute(
       [this] (uInt8 address, uInt8 value) {delayedWrite(address, value);}
     );
@@ -1517,6 +1539,90 @@ void TIA::tickHframe()
     renderPixel(x, y);
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+template<TIA::Priority priority>
+void TIA::tickHframeSpan(uInt32 clocks)
+{
+  myDelayQueue.skip(clocks);
+
+  myCollisionUpdateScheduled = false;
+  myCollisionUpdateRequired = true;
+
+  // Frame manager state only changes on register writes and at the end of the line
+  const bool rendering = myFrameManager->isRendering();
+  const bool vblank = myFrameManager->vblank();
+  uInt8* line = rendering
+    ? myBackBuffer.data() + myFrameManager->getY() * TIAConstants::H_PIXEL
+    : nullptr;
+
+  myTimestamp += clocks;
+
+  // Shorter idle spans cost more to set up than ticking every object through them
+  constexpr uInt32 minIdleSpan = 8;
+
+  while (clocks > 0)
+  {
+    // While no object is drawing or about to start, only the playfield and
+    // background are visible and the objects just count clocks
+    uInt32 idle = myPlayer0.idleClocks(clocks);
+    idle = myPlayer1.idleClocks(idle);
+    idle = myMissile0.idleClocks(idle);
+    idle = myMissile1.idleClocks(idle);
+    idle = myBall.idleClocks(idle);
+
+    if (idle >= minIdleSpan) {
+      myPlayer0.tickIdle(idle);
+      myPlayer1.tickIdle(idle);
+      myMissile0.tickIdle(idle);
+      myMissile1.tickIdle(idle);
+      myBall.tickIdle(idle);
+
+      const uInt32 objectCollision = myPlayer0.collision & myPlayer1.collision &
+        myMissile0.collision & myMissile1.collision & myBall.collision;
+
+      for (uInt32 i = 0; i < idle; ++i, ++myHctr)
+      {
+        const uInt32 x = myHctr - TIAConstants::H_BLANK_CLOCKS - myHctrDelta;
+
+        myPlayfield.tick(x);
+
+        if (rendering && x < TIAConstants::H_PIXEL)
+          line[x] = vblank ? 0 : myPlayfield.isOn() ? myPlayfield.getColor() : myBackground.getColor();
+
+        if (!vblank) myCollisionMask |= objectCollision & myPlayfield.collision;
+
+        #ifdef SOUND_SUPPORT
+          myAudio.tick();
+        #endif
+      }
+
+      clocks -= idle;
+      continue;
+    }
+
+    for (uInt32 n = std::min(clocks, minIdleSpan); n > 0; --n, --clocks, ++myHctr)
+    {
+      const uInt32 x = myHctr - TIAConstants::H_BLANK_CLOCKS - myHctrDelta;
+
+      myPlayfield.tick(x);
+      myMissile0.tick(myHctr);
+      myMissile1.tick(myHctr);
+      myPlayer0.tick();
+      myPlayer1.tick();
+      myBall.tick();
+
+      if (rendering && x < TIAConstants::H_PIXEL)
+        line[x] = vblank ? 0 : pixelColor<priority>();
+
+      if (!vblank) updateCollision();
+
+      #ifdef SOUND_SUPPORT
+        myAudio.tick();
+      #endif
+    }
+  }
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void TIA::applyRsync()
 {
@@ -1597,53 +1703,66 @@ void TIA::renderPixel(uInt32 x, uInt32 y)
   {
     switch (myPriority)
     {
-      case Priority::pfp:  // CTRLPF D2=1, D1=ignored
-        // Playfield has priority so ScoreBit isn't used
-        // Priority from highest to lowest:
-        //   BL/PF => P0/M0 => P1/M1 => BK
-        if (myPlayfield.isOn())       color = myPlayfield.getColor();
-        else if (myBall.isOn())       color = myBall.getColor();
-        else if (myPlayer0.isOn())    color = myPlayer0.getColor();
-        else if (myMissile0.isOn())   color = myMissile0.getColor();
-        else if (myPlayer1.isOn())    color = myPlayer1.getColor();
-        else if (myMissile1.isOn())   color = myMissile1.getColor();
-        else                          color = myBackground.getColor();
-        break;
-
-      case Priority::score:  // CTRLPF D2=0, D1=1
-        // Formally we have (priority from highest to lowest)
-        //   PF/P0/M0 => P1/M1 => BL => BK
-        // for the first half and
-        //   P0/M0 => PF/P1/M1 => BL => BK
-        // for the second half. However, the first ordering is equivalent
-        // to the second (PF has the same color as P0/M0), so we can just
-        // write
-        if (myPlayer0.isOn())         color = myPlayer0.getColor();
-        else if (myMissile0.isOn())   color = myMissile0.getColor();
-        else if (myPlayfield.isOn())  color = myPlayfield.getColor();
-        else if (myPlayer1.isOn())    color = myPlayer1.getColor();
-        else if (myMissile1.isOn())   color = myMissile1.getColor();
-        else if (myBall.isOn())       color = myBall.getColor();
-        else                          color = myBackground.getColor();
-        break;
-
-      case Priority::normal:  // CTRLPF D2=0, D1=0
-        // Priority from highest to lowest:
-        //   P0/M0 => P1/M1 => BL/PF => BK
-        if (myPlayer0.isOn())         color = myPlayer0.getColor();
-        else if (myMissile0.isOn())   color = myMissile0.getColor();
-        else if (myPlayer1.isOn())    color = myPlayer1.getColor();
-        else if (myMissile1.isOn())   color = myMissile1.getColor();
-        else if (myPlayfield.isOn())  color = myPlayfield.getColor();
-        else if (myBall.isOn())       color = myBall.getColor();
-        else                          color = myBackground.getColor();
-        break;
+      case Priority::pfp:    color = pixelColor<Priority::pfp>();    break;
+      case Priority::score:  color = pixelColor<Priority::score>();  break;
+      case Priority::normal: color = pixelColor<Priority::normal>(); break;
     }
   }
 
   myBackBuffer[y * TIAConstants::H_PIXEL + x] = color;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+template<TIA::Priority priority>
+uInt8 TIA::pixelColor() const
+{
+  if constexpr (priority == Priority::pfp)
+  {
+    // CTRLPF D2=1, D1=ignored
+    // Playfield has priority so ScoreBit isn't used
+    // Priority from highest to lowest:
+    //   BL/PF => P0/M0 => P1/M1 => BK
+    if (myPlayfield.isOn())       return myPlayfield.getColor();
+    else if (myBall.isOn())       return myBall.getColor();
+    else if (myPlayer0.isOn())    return myPlayer0.getColor();
+    else if (myMissile0.isOn())   return myMissile0.getColor();
+    else if (myPlayer1.isOn())    return myPlayer1.getColor();
+    else if (myMissile1.isOn())   return myMissile1.getColor();
+    else                          return myBackground.getColor();
+  }
+  else if constexpr (priority == Priority::score)
+  {
+    // CTRLPF D2=0, D1=1
+    // Formally we have (priority from highest to lowest)
+    //   PF/P0/M0 => P1/M1 => BL => BK
+    // for the first half and
+    //   P0/M0 => PF/P1/M1 => BL => BK
+    // for the second half. However, the first ordering is equivalent
+    // to the second (PF has the same color as P0/M0), so we can just
+    // write
+    if (myPlayer0.isOn())         return myPlayer0.getColor();
+    else if (myMissile0.isOn())   return myMissile0.getColor();
+    else if (myPlayfield.isOn())  return myPlayfield.getColor();
+    else if (myPlayer1.isOn())    return myPlayer1.getColor();
+    else if (myMissile1.isOn())   return myMissile1.getColor();
+    else if (myBall.isOn())       return myBall.getColor();
+    else                          return myBackground.getColor();
+  }
+  else
+  {
+    // CTRLPF D2=0, D1=0
+    // Priority from highest to lowest:
+    //   P0/M0 => P1/M1 => BL/PF => BK
+    if (myPlayer0.isOn())         return myPlayer0.getColor();
+    else if (myMissile0.isOn())   return myMissile0.getColor();
+    else if (myPlayer1.isOn())    return myPlayer1.getColor();
+    else if (myMissile1.isOn())   return myMissile1.getColor();
+    else if (myPlayfield.isOn())  return myPlayfield.getColor();
+    else if (myBall.isOn())       return myBall.getColor();
+    else                          return myBackground.getColor();
+  }
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void TIA::flushLineCache()
 {
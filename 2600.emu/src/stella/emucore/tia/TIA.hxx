@@ -640,6 +640,13 @@ class TIA : public Device
      */
     void tickHframe();
 
+    /**
+     * Advance several clocks within the visible part of the scanline. Only valid
+     * while no delayed writes or HMOVE are pending and the span ends before the
+     * last clock of the line (see cycle()).
+     */
+    template<Priority priority> void tickHframeSpan(uInt32 clocks);
+
     /**
      * Update the collision bitfield.
      */
@@ -655,6 +662,11 @@ class TIA : public Device
      */
     void renderPixel(uInt32 x, uInt32 y);
 
+    /**
+     * Color of the current pixel outside of vblank for the given priority mode.
+     */
+    template<Priority priority> uInt8 pixelColor() const;
+
     /**
      * Clear the first 8 pixels of a scanline with black if we are in hblank
      * (called during HMOVE).
@@ -70,6 +70,8 @@ VICE_API void machine_set_restore_key(int v);
 VICE_API int machine_write_snapshot(const char *name, int save_roms,
                                   int save_disks, int even_mode);
 VICE_API int machine_read_snapshot(const char *name, int even_mode);
+VICE_API int vice_snapshot_write_mem(uint8_t *data, size_t *size, int save_roms, int save_disks);
+VICE_API int vice_snapshot_read_mem(uint8_t *data, size_t size);
 //VICE_API void machine_shutdown(void); // TODO: not used currently
 VICE_API struct drive_type_info_s *machine_drive_get_type_info_list(void);
 
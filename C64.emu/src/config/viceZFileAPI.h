@@ -3,4 +3,7 @@
 #endif
 
 VICE_API FILE *zfile_fopen(const char *name, const char *mode);
+/* Opens a stream on a memory buffer of *size bytes, *size is updated with the final
+   size on close. Passing a NULL data pointer only counts the bytes written. */
+VICE_API FILE *zfile_fmemopen(uint8_t *data, size_t *size, const char *mode);
 VICE_API off_t archdep_file_size(FILE *stream);
@@ -16,7 +16,6 @@
 #define LOGTAG "main"
 #include <emuframework/EmuAppInlines.hh>
 #include <emuframework/EmuSystemInlines.hh>
-#include <imagine/thread/Semaphore.hh>
 #include <imagine/gui/AlertView.hh>
 #include <imagine/util/format.hh>
 #include <imagine/util/string.h>
@@ -82,16 +81,17 @@ C64App::C64App(ApplicationInitParams initParams, ApplicationContext &ctx):
 }
 
 C64System::C64System(ApplicationContext ctx):
-	EmuSystem{ctx}
-{
-	makeDetachedThread(
+	EmuSystem{ctx},
+	viceFiber
+	{
 		[this]()
 		{
-			emuThreadId = thisThreadId();
-			execSem.acquire();
 			log.info("starting maincpu_mainloop()");
 			plugin.maincpu_mainloop();
-		});
+		},
+		4 * 1024 * 1024
+	}
+{
 
 	if(sysFilePath.size() == 3)
 	{
@@ -220,54 +220,40 @@ FS::FileString C64System::stateFilename(int slot, std::string_view name) const
 	return IG::format<FS::FileString>("{}.{}.vsf", name, saveSlotChar(slot));
 }
 
+// VICE's main loop runs in a fiber until the next vsync or CPU trap. While the emulation thread is
+// running, the fiber is only resumed from it, even when another thread requests a CPU trap.
+void C64System::resumeVice()
+{
+	EmuApp::get(appContext()).runOnEmulationThread([this]()
+	{
+		assert(!viceFiberResumed);
+		viceFiberResumed = true;
+		viceFiber.resume();
+	});
+}
+
 void C64System::enterCPUTrap()
 {
-	assert(emuThreadId);
 	if(inCPUTrap)
 		return;
 	plugin.interrupt_maincpu_trigger_trap([](uint16_t, void *data)
 	{
 		auto &sys = *((C64System*)data);
 		sys.inCPUTrap = true;
-		sys.signalEmuTaskThreadAndWait();
+		sys.yieldToEmuTask();
 		sys.inCPUTrap = false;
 	}, (void*)this);
 	while(!inCPUTrap)
 	{
-		signalViceThreadAndWait();
-	}
-}
-
-struct SnapshotData
-{
-	uint8_t *buffData{};
-	size_t buffSize{};
-};
-
-static std::array<char, 32> snapshotVPath(SnapshotData &data)
-{
-	std::array<char, 32> fileStr;
-	// Encode the data/size pointers after the string null terminator
-	if(data.buffData)
-	{
-		auto it = std::ranges::copy(":::B", std::begin(fileStr)).out;
-		it = std::ranges::copy(addressAsBytes(data.buffSize), it).out;
-		std::ranges::copy(asBytes(data.buffData), it);
-		//log.info("encoded size ptr:{} data ptr:{}", (void*)&data.buffSize, (void*)data.buffData);
-	}
-	else
-	{
-		auto it = std::ranges::copy(":::N", std::begin(fileStr)).out;
-		std::ranges::copy(addressAsBytes(data.buffSize), it);
-		//log.info("encoded size ptr:{}", (void*)&data.buffSize);
+		resumeVice();
 	}
-	return fileStr;
 }
 
-static bool saveSnapshot(auto &plugin, SnapshotData &snapData)
+static bool saveSnapshot(auto &plugin, uint8_t *data, size_t &size, SaveStateFlags flags)
 {
-	//log.info("saving state at:{} size:{}", (void*)snapData.buffData, snapData.buffSize);
-	if(auto err = plugin.machine_write_snapshot(snapshotVPath(snapData).data(), 1, 1, 0);
+	// transient states are only restored in the same session so skip ROM and disk image data
+	bool saveMedia = !flags.transient;
+	if(auto err = plugin.snapshot_write_mem(data, &size, saveMedia, saveMedia);
 		err < 0)
 	{
 		log.error("error writing snapshot:{}", err);
@@ -276,11 +262,10 @@ static bool saveSnapshot(auto &plugin, SnapshotData &snapData)
 	return true;
 }
 
-static bool loadSnapshot(auto &plugin, SnapshotData &snapData)
+static bool loadSnapshot(auto &plugin, std::span<uint8_t> buff)
 {
-	assumeExpr(snapData.buffData);
-	log.info("loading state at:{} size:{}", (void*)snapData.buffData, snapData.buffSize);
-	if(plugin.machine_read_snapshot(snapshotVPath(snapData).data(), 0) < 0)
+	log.info("loading state at:{} size:{}", (void*)buff.data(), buff.size());
+	if(plugin.snapshot_read_mem(buff.data(), buff.size()) < 0)
 		return false;
 	return true;
 }
@@ -288,23 +273,22 @@ static bool loadSnapshot(auto &plugin, SnapshotData &snapData)
 size_t C64System::stateSize()
 {
 	enterCPUTrap();
-	SnapshotData data{};
-	saveSnapshot(plugin, data);
-	return data.buffSize;
+	size_t size{};
+	saveSnapshot(plugin, nullptr, size, {});
+	return size;
 }
 
 void C64System::readState(EmuApp &app, std::span<uint8_t> buff)
 {
-	signalViceThreadAndWait();
+	resumeVice();
 	enterCPUTrap();
 	plugin.vsync_set_warp_mode(0);
-	SnapshotData data{.buffData = buff.data(), .buffSize = buff.size()};
-	if(!loadSnapshot(plugin, data))
+	if(!loadSnapshot(plugin, buff))
 		throw std::runtime_error("Invalid state data");
 	// reload snapshot in case last load caused a reboot due to model change
-	signalViceThreadAndWait();
+	resumeVice();
 	enterCPUTrap();
-	if(!loadSnapshot(plugin, data))
+	if(!loadSnapshot(plugin, buff))
 		throw std::runtime_error("Invalid state data");
 	updateJoystickDevices();
 }
@@ -312,10 +296,10 @@ void C64System::readState(EmuApp &app, std::span<uint8_t> buff)
 size_t C64System::writeState(std::span<uint8_t> buff, SaveStateFlags flags)
 {
 	enterCPUTrap();
-	SnapshotData data{.buffData = buff.data(), .buffSize = buff.size()};
-	if(!saveSnapshot(plugin, data))
+	size_t size = buff.size();
+	if(!saveSnapshot(plugin, buff.data(), size, flags))
 		return 0;
-	return data.buffSize;
+	return size;
 }
 
 VideoSystem C64System::videoSystem() const
@@ -495,7 +479,7 @@ void C64System::runFrame(EmuSystemTaskContext taskCtx, EmuVideo *video, EmuAudio
 {
 	audioPtr = audio;
 	setCanvasSkipFrame(!video);
-	signalViceThreadAndWait();
+	resumeVice();
 	if(video)
 	{
 		video->startFrameWithAltFormat(taskCtx, canvasSrcPix);
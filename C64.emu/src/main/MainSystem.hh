@@ -16,9 +16,8 @@
 	along with C64.emu.  If not, see <http://www.gnu.org/licenses/> */
 
 #include "VicePlugin.hh"
-#include <imagine/thread/Semaphore.hh>
 #include <imagine/pixmap/Pixmap.hh>
-#include <imagine/thread/Thread.hh>
+#include <imagine/thread/Fiber.hh>
 #include <imagine/fs/FS.hh>
 #include <imagine/fs/ArchiveFS.hh>
 #include <emuframework/EmuSystem.hh>
@@ -120,11 +119,10 @@ class C64System final: public EmuSystem
 {
 public:
 	double systemFrameRate{60.};
-	std::binary_semaphore execSem{0}, execDoneSem{0};
+	Fiber viceFiber;
 	EmuAudio *audioPtr{};
 	struct video_canvas_s *activeCanvas{};
 	const char *sysFileDir{};
-	ThreadId emuThreadId{};
 	VicePlugin plugin{};
 	mutable ArchiveIO firmwareArch;
 	std::string defaultPaletteName{};
@@ -132,7 +130,7 @@ public:
 	IG::PixmapView canvasSrcPix{};
 	PixelFormat pixFmt{PixelFmtRGBA8888};
 	ViceSystem currSystem{};
-	bool viceThreadSignaled{};
+	bool viceFiberResumed{};
 	bool inCPUTrap{};
 	Property<JoystickMode, CFGKEY_DEFAULT_JOYSTICK_MODE,
 		PropertyDesc<JoystickMode>{.defaultValue = JoystickMode::Port2}> defaultJoystickMode;
@@ -203,21 +201,14 @@ public:
 	void setSystemFilesPath(CStringView path, FS::file_type);
 	void enterCPUTrap();
 
-	void signalViceThreadAndWait()
-	{
-		assert(!viceThreadSignaled);
-		viceThreadSignaled = true;
-		execSem.release();
-		execDoneSem.acquire();
-	}
+	void resumeVice();
 
-	bool signalEmuTaskThreadAndWait()
+	bool yieldToEmuTask()
 	{
-		if(!viceThreadSignaled)
+		if(!viceFiberResumed)
 			return false;
-		viceThreadSignaled = false;
-		execDoneSem.release();
-		execSem.acquire();
+		viceFiberResumed = false;
+		viceFiber.yield();
 		return true;
 	}
 
@@ -252,7 +243,6 @@ public:
 	void renderFramebuffer(EmuVideo &);
 	bool shouldFastForward() const;
 	bool onVideoRenderFormatChange(EmuVideo &, PixelFormat);
-	void addThreadGroupIds(std::vector<ThreadId> &ids) const { ids.emplace_back(emuThreadId); }
 
 protected:
 	void initC64(EmuApp &app);
@@ -277,17 +277,17 @@ int VicePlugin::resources_get_default_value(const char *name, void *value_return
 	return -1;
 }
 
-int VicePlugin::machine_write_snapshot(const char *name, int save_roms, int save_disks, int even_mode) const
+int VicePlugin::snapshot_write_mem(uint8_t *data, size_t *size, int save_roms, int save_disks) const
 {
-	if(machine_write_snapshot_)
-		return machine_write_snapshot_(name, save_roms, save_disks, even_mode);
+	if(snapshot_write_mem_)
+		return snapshot_write_mem_(data, size, save_roms, save_disks);
 	return -1;
 }
 
-int VicePlugin::machine_read_snapshot(const char *name, int event_mode) const
+int VicePlugin::snapshot_read_mem(uint8_t *data, size_t size) const
 {
-	if(machine_read_snapshot_)
-		return machine_read_snapshot_(name, event_mode);
+	if(snapshot_read_mem_)
+		return snapshot_read_mem_(data, size);
 	return -1;
 }
 
@@ -514,8 +514,8 @@ VicePlugin commonVicePlugin(void *lib, ViceSystem system)
 	loadSymbolCheck(plugin.resources_get_int_, lib, "resources_get_int");
 	loadSymbolCheck(plugin.resources_set_int_, lib, "resources_set_int");
 	loadSymbolCheck(plugin.resources_get_default_value_, lib, "resources_get_default_value");
-	loadSymbolCheck(plugin.machine_write_snapshot_, lib, "machine_write_snapshot");
-	loadSymbolCheck(plugin.machine_read_snapshot_, lib, "machine_read_snapshot");
+	loadSymbolCheck(plugin.snapshot_write_mem_, lib, "vice_snapshot_write_mem");
+	loadSymbolCheck(plugin.snapshot_read_mem_, lib, "vice_snapshot_read_mem");
 	loadSymbolCheck(plugin.machine_set_restore_key_, lib, "machine_set_restore_key");
 	loadSymbolCheck(plugin.machine_trigger_reset_, lib, "machine_trigger_reset");
 	loadSymbolCheck(plugin.machine_drive_get_type_info_list_, lib, "machine_drive_get_type_info_list");
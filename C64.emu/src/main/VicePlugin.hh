@@ -60,8 +60,8 @@ struct VicePlugin
 	int (*resources_get_int_)(const char *name, int *value_return){};
 	int (*resources_set_int_)(const char *name, int value){};
 	int (*resources_get_default_value_)(const char *name, void *value_return){};
-	int (*machine_write_snapshot_)(const char *name, int save_roms, int save_disks, int even_mode){};
-	int (*machine_read_snapshot_)(const char *name, int event_mode){};
+	int (*snapshot_write_mem_)(uint8_t *data, size_t *size, int save_roms, int save_disks){};
+	int (*snapshot_read_mem_)(uint8_t *data, size_t size){};
 	void (*machine_set_restore_key_)(int v){};
 	void (*machine_trigger_reset_)(const unsigned int mode){};
 	struct drive_type_info_s *(*machine_drive_get_type_info_list_)(){};
@@ -111,8 +111,8 @@ struct VicePlugin
 	int resources_get_int(const char *name, int *value_return) const;
 	int resources_set_int(const char *name, int value);
 	int resources_get_default_value(const char *name, void *value_return) const;
-	int machine_write_snapshot(const char *name, int save_roms, int save_disks, int even_mode) const;
-	int machine_read_snapshot(const char *name, int event_mode) const;
+	int snapshot_write_mem(uint8_t *data, size_t *size, int save_roms, int save_disks) const;
+	int snapshot_read_mem(uint8_t *data, size_t size) const;
 	void machine_set_restore_key(int v);
 	void machine_trigger_reset(const unsigned int mode);
 	struct drive_type_info_s *machine_drive_get_type_info_list();
@@ -56,6 +56,7 @@
 #include "mousedrv.h"
 #include "rs232.h"
 #include "coproc.h"
+#include "snapshot.h"
 
 VICE_API int vice_init();
 
@@ -613,6 +614,22 @@ int vice_init()
 	return 0;
 }
 
+int vice_snapshot_write_mem(uint8_t *data, size_t *size, int save_roms, int save_disks)
+{
+	snapshot_set_memory_stream(data, size);
+	int err = machine_write_snapshot("", save_roms, save_disks, 0);
+	snapshot_set_memory_stream(NULL, NULL);
+	return err;
+}
+
+int vice_snapshot_read_mem(uint8_t *data, size_t size)
+{
+	snapshot_set_memory_stream(data, &size);
+	int err = machine_read_snapshot("", 0);
+	snapshot_set_memory_stream(NULL, NULL);
+	return err;
+}
+
 void bug_doExit(const char *msg, ...)
 {
 	#ifdef __ANDROID__
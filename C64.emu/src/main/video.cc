@@ -48,7 +48,7 @@ CLINK LVISIBLE void vsync_do_vsync2(struct video_canvas_s *c);
 void vsync_do_vsync2(struct video_canvas_s *c)
 {
 	auto &sys = c64Sys(c);
-	if(!sys.signalEmuTaskThreadAndWait())
+	if(!sys.yieldToEmuTask())
 	{
 		logMsg("spurious vsync_do_vsync()");
 	}
@@ -41,24 +41,7 @@ CLINK FILE *zfile_fopen(const char *path_, const char *mode_)
 	std::string_view path{path_};
 	std::string_view mode{mode_};
 	auto appContext = gAppContext();
-	if(path == ":::N") // null output
-	{
-		size_t *buffSizePtr;
-		std::ranges::copy(std::span{path_ + 5, sizeof(buffSizePtr)}, asWritableBytes(buffSizePtr).begin());
-		//EmuEx::log.info("decoded size ptr:{}", (void*)buffSizePtr);
-		return OutSizeTracker{buffSizePtr}.toFileStream(mode_);
-	}
-	else if(path == ":::B") // buffer input/output
-	{
-		size_t *buffSizePtr;
-		auto it = std::ranges::copy(std::span{path_ + 5, sizeof(buffSizePtr)}, asWritableBytes(buffSizePtr).begin()).in;
-		uint8_t *buffDataPtr;
-		std::ranges::copy(std::span{it, sizeof(buffDataPtr)}, asWritableBytes(buffDataPtr).begin());
-		//EmuEx::log.info("decoded size ptr:{} ({}) buff ptr:{}", (void*)buffSizePtr, *buffSizePtr, (void*)buffDataPtr);
-		return MapIO{IOBuffer{std::span<uint8_t>{buffDataPtr, *buffSizePtr},
-			[buffSizePtr](const uint8_t *, size_t size){ *buffSizePtr = size; }}}.toFileStream(mode_);
-	}
-	else if(EmuApp::hasArchiveExtension(appContext.fileUriDisplayName(path)))
+	if(EmuApp::hasArchiveExtension(appContext.fileUriDisplayName(path)))
 	{
 		if(mode.contains('w') || mode.contains('+'))
 		{
@@ -93,6 +76,14 @@ CLINK FILE *zfile_fopen(const char *path_, const char *mode_)
 	}
 }
 
+CLINK FILE *zfile_fmemopen(uint8_t *data, size_t *size, const char *mode)
+{
+	if(!data) // null output
+		return OutSizeTracker{size}.toFileStream(mode);
+	return MapIO{IOBuffer{std::span<uint8_t>{data, *size},
+		[size](const uint8_t *, size_t newSize){ *size = newSize; }}}.toFileStream(mode);
+}
+
 CLINK off_t archdep_file_size(FILE *stream)
 {
 	off_t pos = ftello(stream);
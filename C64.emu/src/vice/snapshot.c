@@ -798,6 +798,24 @@ int snapshot_module_close(snapshot_module_t *m)
 
 /* ------------------------------------------------------------------------- */
 
+/* When set, snapshots are read from/written to this buffer instead of the named file */
+static uint8_t *snapshot_mem_data = NULL;
+static size_t *snapshot_mem_size = NULL;
+
+void snapshot_set_memory_stream(uint8_t *data, size_t *size)
+{
+    snapshot_mem_data = data;
+    snapshot_mem_size = size;
+}
+
+static FILE *snapshot_fopen(const char *filename, const char *mode)
+{
+    if (snapshot_mem_size) {
+        return zfile_fmemopen(snapshot_mem_data, snapshot_mem_size, mode);
+    }
+    return zfile_fopen(filename, mode);
+}
+
 snapshot_t *snapshot_create(const char *filename, uint8_t major_version, uint8_t minor_version, const char *snapshot_machine_name)
 {
     FILE *f;
@@ -806,7 +824,7 @@ snapshot_t *snapshot_create(const char *filename, uint8_t major_version, uint8_t
 
     current_filename = (char *)filename;
 
-    f = fopen(filename, MODE_WRITE);
+    f = snapshot_fopen(filename, MODE_WRITE);
     if (f == NULL) {
         snapshot_error = SNAPSHOT_CANNOT_CREATE_SNAPSHOT_ERROR;
         return NULL;
@@ -879,7 +897,7 @@ snapshot_t *snapshot_open(const char *filename, uint8_t *major_version_return, u
     current_filename = (char *)filename;
     current_module = NULL;
 
-    f = zfile_fopen(filename, MODE_READ);
+    f = snapshot_fopen(filename, MODE_READ);
     if (f == NULL) {
         snapshot_error = SNAPSHOT_CANNOT_OPEN_FOR_READ_ERROR;
         return NULL;
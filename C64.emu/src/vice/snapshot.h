@@ -132,6 +132,7 @@ snapshot_module_t *snapshot_module_create(snapshot_t *s, const char *name, uint8
 snapshot_module_t *snapshot_module_open(snapshot_t *s, const char *name, uint8_t *major_version_return, uint8_t *minor_version_return);
 int snapshot_module_close(snapshot_module_t *m);
 
+void snapshot_set_memory_stream(uint8_t *data, size_t *size);
 snapshot_t *snapshot_create(const char *filename, uint8_t major_version, uint8_t minor_version, const char *snapshot_machine_name);
 snapshot_t *snapshot_open(const char *filename, uint8_t *major_version_return, uint8_t *minor_version_return, const char *snapshot_machine_name);
 int snapshot_close(snapshot_t *s);
@@ -30,6 +30,7 @@
 
 #include <stdio.h>
 #include "vice.h"
+#include "types.h"
 
 /* actions to be done when a zfile is closed */
 typedef enum {
@@ -1,6 +1,7 @@
 include $(IMAGINE_PATH)/make/imagineStaticLibBase.mk
 
 SRC += \
+ArchiveExtractCache.cc \
 AssetManager.cc \
 AutosaveManager.cc \
 ConfigFile.cc \
@@ -13,6 +14,7 @@ EmuSystemTask.cc \
 EmuTiming.cc \
 EmuVideo.cc \
 EmuVideoLayer.cc \
+GameplayRecorder.cc \
 InputDeviceConfig.cc \
 InputDeviceData.cc \
 KeyConfig.cc \
@@ -20,6 +22,7 @@ OutputTimingManager.cc \
 pathUtils.cc \
 RecentContent.cc \
 RewindManager.cc \
+ScreenshotWriter.cc \
 ToggleInput.cc \
 TurboInput.cc \
 VideoImageEffect.cc \
@@ -46,6 +46,7 @@ enum class AppKeyCode : KeyCode
 	hardReset,
 	resetMenu,
 	closeContent,
+	takeScreenshotBurst,
 };
 
 constexpr struct AppKeys
@@ -65,6 +66,7 @@ constexpr struct AppKeys
 	toggleSlowMotion = KeyInfo::appKey(AppKeyCode::toggleSlowMotion),
 	rewind = KeyInfo::appKey(AppKeyCode::rewind),
 	takeScreenshot = KeyInfo::appKey(AppKeyCode::takeScreenshot),
+	takeScreenshotBurst = KeyInfo::appKey(AppKeyCode::takeScreenshotBurst),
 	turboModifier = KeyInfo::appKey(AppKeyCode::turboModifier),
 	softReset = KeyInfo::appKey(AppKeyCode::softReset),
 	hardReset = KeyInfo::appKey(AppKeyCode::hardReset),
@@ -0,0 +1,78 @@
+#pragma once
+
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <emuframework/EmuSystem.hh>
+#include <imagine/base/ApplicationContext.hh>
+#include <imagine/io/IO.hh>
+#include <imagine/fs/FSDefs.hh>
+#include <atomic>
+#include <string>
+#include <thread>
+
+namespace IG
+{
+class MapIO;
+class FileIO;
+}
+
+namespace EmuEx
+{
+
+using namespace IG;
+
+class RecentContent;
+
+// Keeps extracted archive entries in a size-bounded directory so loading the same
+// content again maps the cached file instead of decompressing it. Entries are keyed
+// by the name, size, and CRC of the archived file, the least recently used ones are
+// removed when the total size exceeds the limit. Only single entries opened by
+// EmuSystem::loadContentFromFile() are cached, systems that set handlesArchiveFiles
+// (Saturn.emu, whose disc images span several entries) read archives directly.
+class ArchiveExtractCache
+{
+public:
+	static constexpr uint32_t defaultMaxSizeMiB{1024};
+	static constexpr size_t maxPreExtractEntries{3};
+
+	ArchiveExtractCache(ApplicationContext ctx): ctx{ctx} {}
+	~ArchiveExtractCache() { stopPreExtract(); }
+	bool isEnabled() const { return maxSizeMiB; }
+	FS::PathString directory() const;
+	// Returns the cached copy of the entry, extracting it first if needed,
+	// or an empty IO if it can't be cached
+	IO open(ArchiveIO &entry, std::string_view archivePath, size_t archiveSize,
+		EmuSystem::OnLoadProgressDelegate onLoadProgress = {});
+	// Extracts the first loadable entry of recently opened archives on a low priority thread
+	void startPreExtract(const RecentContent &);
+	void stopPreExtract();
+	bool readConfig(MapIO &, unsigned key);
+	void writeConfig(FileIO &) const;
+
+	std::string userDirectory;
+	uint32_t maxSizeMiB{defaultMaxSizeMiB};
+
+private:
+	ApplicationContext ctx;
+	std::thread preExtractThread;
+	std::atomic_bool cancelExtract{};
+
+	FS::PathString entryPath(ArchiveIO &entry, std::string_view archivePath, size_t archiveSize) const;
+	bool extract(ArchiveIO &entry, CStringView path, EmuSystem::OnLoadProgressDelegate);
+	void evict(CStringView keepPath) const;
+};
+
+}
@@ -19,6 +19,7 @@
 #include <imagine/base/PausableTimer.hh>
 #include <imagine/fs/FSDefs.hh>
 #include <imagine/io/FileIO.hh>
+#include <imagine/thread/WorkThread.hh>
 #include <imagine/util/enum.hh>
 #include <string>
 #include <string_view>
@@ -50,12 +51,15 @@ class AutosaveManager
 public:
 	AutosaveManager(EmuApp &);
 	bool save(AutosaveActionSource src = AutosaveActionSource::Auto);
+	bool saveAsync();
+	void waitForPendingSave() { if(saveThread.joinable()) saveThread.join(); }
 	bool load(AutosaveActionSource src, LoadAutosaveMode m);
 	bool load(LoadAutosaveMode m) { return load(AutosaveActionSource::Auto, m); }
 	bool load(AutosaveActionSource src = AutosaveActionSource::Auto) { return load(src, LoadAutosaveMode::Normal); }
 	bool setSlot(std::string_view name);
 	void resetSlot(std::string_view name = "")
 	{
+		waitForPendingSave();
 		autoSaveSlot = name;
 		saveTimer.cancel();
 		stateIO = {};
@@ -83,6 +87,7 @@ private:
 	EmuApp &app;
 	std::string autoSaveSlot;
 	FileIO stateIO;
+	WorkThread saveThread;
 
 	bool saveState();
 	bool loadState();
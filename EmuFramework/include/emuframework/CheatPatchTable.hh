@@ -0,0 +1,78 @@
+#pragma once
+
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+namespace EmuEx
+{
+
+enum class DuplicatePatch { KeepFirst, KeepLast };
+
+// Compiled, address-sorted list of enabled cheat patches. Systems rebuild it
+// only when the cheat list changes, then either look up single addresses from
+// a read handler or apply all patches in bulk once per frame.
+template<class Patch>
+class CheatPatchTable
+{
+public:
+	using Address = decltype(Patch::addr);
+
+	constexpr CheatPatchTable() = default;
+	void clear() { patches_.clear(); }
+	bool empty() const { return patches_.empty(); }
+	size_t size() const { return patches_.size(); }
+	std::span<const Patch> patches() const { return patches_; }
+	auto begin() const { return patches_.begin(); }
+	auto end() const { return patches_.end(); }
+
+	// Patches may be added in any order, call compile() before the next lookup
+	void add(const Patch& p) { patches_.emplace_back(p); }
+
+	// Sorts by address, keeping only the first or last added patch for each address
+	void compile(DuplicatePatch keep = DuplicatePatch::KeepFirst)
+	{
+		std::ranges::stable_sort(patches_, {}, &Patch::addr);
+		if(keep == DuplicatePatch::KeepLast)
+			std::ranges::reverse(patches_);
+		auto [first, last] = std::ranges::unique(patches_, {}, &Patch::addr);
+		patches_.erase(first, last);
+		if(keep == DuplicatePatch::KeepLast)
+			std::ranges::reverse(patches_);
+	}
+
+	const Patch* find(Address addr) const
+	{
+		auto it = std::ranges::lower_bound(patches_, addr, {}, &Patch::addr);
+		if(it == patches_.end() || it->addr != addr)
+			return {};
+		return &*it;
+	}
+
+	bool contains(Address addr) const { return find(addr); }
+
+	void apply(auto&& func) const
+	{
+		for(const auto& p: patches_) { func(p); }
+	}
+
+protected:
+	std::vector<Patch> patches_;
+};
+
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <sys/types.h>
+
+namespace EmuEx
+{
+
+// Keeps a copy of the backup memory contents last written to disk and on flush only
+// passes the pages that changed since then to the write function. Runs of dirty pages
+// separated by a single clean page are merged into one write.
+class DirtyPageWriter
+{
+public:
+	static constexpr size_t defaultPageSize = 512;
+
+	constexpr DirtyPageWriter(size_t pageSize = defaultPageSize): pageSize{pageSize} {}
+
+	void reset() { written.clear(); }
+	void setWritten(std::span<const uint8_t> data) { written.assign(data.begin(), data.end()); }
+	bool hasWrittenData() const { return written.size(); }
+
+	// Calls bool writeRange(size_t offset, std::span<const uint8_t>) for each changed range
+	// and returns the total bytes written, the whole buffer is written on the first flush.
+	// Returns -1 if writeRange() fails, the next flush then rewrites the whole buffer.
+	ssize_t flush(std::span<const uint8_t> data, auto &&writeRange)
+	{
+		if(written.size() != data.size())
+		{
+			if(!writeRange(size_t{}, data))
+			{
+				reset();
+				return -1;
+			}
+			setWritten(data);
+			return data.size();
+		}
+		ssize_t bytes{};
+		size_t runStart{}, runEnd{};
+		auto writeRun = [&]
+		{
+			if(runStart == runEnd || bytes < 0)
+				return;
+			auto run = data.subspan(runStart, runEnd - runStart);
+			if(!writeRange(runStart, run))
+			{
+				reset();
+				bytes = -1;
+				return;
+			}
+			std::ranges::copy(run, written.begin() + runStart);
+			bytes += run.size();
+		};
+		for(size_t offset = 0; offset < data.size(); offset += pageSize)
+		{
+			auto size = std::min(pageSize, data.size() - offset);
+			if(!std::memcmp(&data[offset], &written[offset], size))
+				continue;
+			if(runStart != runEnd && offset - runEnd > pageSize)
+			{
+				writeRun();
+				if(bytes < 0)
+					return bytes;
+				runStart = offset;
+			}
+			else if(runStart == runEnd)
+			{
+				runStart = offset;
+			}
+			runEnd = offset + size;
+		}
+		writeRun();
+		return bytes;
+	}
+
+protected:
+	std::vector<uint8_t> written;
+	size_t pageSize;
+};
+
+}
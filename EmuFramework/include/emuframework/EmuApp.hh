@@ -27,6 +27,9 @@
 #include <emuframework/RecentContent.hh>
 #include <emuframework/RewindManager.hh>
 #include <emuframework/AssetManager.hh>
+#include <emuframework/ArchiveExtractCache.hh>
+#include <emuframework/ScreenshotWriter.hh>
+#include <emuframework/GameplayRecorder.hh>
 #include <imagine/input/inputDefs.hh>
 #include <imagine/input/android/MogaManager.hh>
 #include <imagine/gui/ViewManager.hh>
@@ -38,8 +41,8 @@
 #include <imagine/base/PerformanceHintManager.hh>
 #include <imagine/audio/Manager.hh>
 #include <imagine/gfx/Renderer.hh>
-#include <imagine/data-type/image/PixmapWriter.hh>
 #include <imagine/bluetooth/BluetoothAdapter.hh>
+#include <imagine/thread/WorkThread.hh>
 #include <imagine/font/Font.hh>
 #include <imagine/util/used.hh>
 #include <imagine/util/enum.hh>
@@ -152,7 +155,9 @@ public:
 	void launchSystem(const Input::Event &);
 	static bool hasArchiveExtension(std::string_view name);
 	void unpostMessage();
-	void printScreenshotResult(bool success);
+	void printScreenshotResult(bool success, int burstFrames = -1);
+	void startRecording();
+	void stopRecording();
 	FS::PathString contentSavePath(std::string_view name) const;
 	FS::PathString contentSaveFilePath(std::string_view ext) const;
 	void setupStaticBackupMemoryFile(FileIO &, std::string_view ext, size_t staticSize, uint8_t initValue = 0) const;
@@ -181,6 +186,7 @@ public:
 	void deleteSessionOptions();
 	[[nodiscard]]
 	EmuSystemTask::SuspendContext suspendEmulationThread();
+	void runOnEmulationThread(DelegateFunc<void()> func) { systemTask.runOnThread(func); }
 	void startAudio();
 	EmuViewController &viewController();
 	const EmuViewController &viewController() const;
@@ -203,7 +209,7 @@ public:
 	void renderSystemFramebuffer(EmuVideo &);
 	void renderSystemFramebuffer() { renderSystemFramebuffer(video); }
 	bool writeScreenshot(IG::PixmapView, CStringView path);
-	FS::PathString makeNextScreenshotFilename();
+	FS::PathString makeNextScreenshotFilename(int burstIndex = -1);
 	bool mogaManagerIsActive() const { return bool(mogaManagerPtr); }
 	void setMogaManagerActive(bool on, bool notify);
 	void closeBluetoothConnections();
@@ -213,6 +219,7 @@ public:
 	void record(FrameTimingStatEvent, SteadyClockTimePoint t = {});
 	static std::u16string_view mainViewName();
 	void runBenchmarkOneShot(EmuVideo &);
+	void runBatchOneShot(CStringView dirUri);
 	void onSelectFileFromPicker(IG::IO, CStringView path, std::string_view displayName,
 		const Input::Event &, EmuSystemCreateParams, ViewAttachParams);
 	void handleOpenFileCommand(CStringView path);
@@ -255,6 +262,7 @@ public:
 	void setCPUAffinity(int cpuNumber, bool on);
 	bool cpuAffinity(int cpuNumber) const;
 	void applyCPUAffinity(bool active);
+	uint64_t discImageMemCacheMaxSize() const;
 
 	// GUI Options
 	void setIdleDisplayPowerSave(bool on);
@@ -336,6 +344,10 @@ public:
 	DrawableConfig windowDrawableConfig;
 	BluetoothAdapter bluetoothAdapter;
 	RecentContent recentContent;
+	ArchiveExtractCache archiveCache;
+	ScreenshotWriter screenshotWriter;
+	GameplayRecorder recorder;
+	WorkThread batchRunThread;
 	FS::PathString contentSearchPath;
 	std::string userScreenshotPath;
 	Property<IG::PixelFormat, CFGKEY_RENDER_PIXEL_FORMAT,
@@ -386,6 +398,9 @@ public:
 	ConditionalMember<Gfx::supportsPresentationTime, PresentationTimeMode> presentationTimeMode{PresentationTimeMode::basic};
 	Property<bool, CFGKEY_BLANK_FRAME_INSERTION> allowBlankFrameInsertion;
 	Property<bool, CFGKEY_SHOW_FRAME_TIMING_STATS> showFrameTimingStats;
+	Property<bool, CFGKEY_LOW_LATENCY_FRAME_PACING> lowLatencyFramePacing;
+	ConditionalProperty<Config::envIsLinux, bool, CFGKEY_INPUT_DEVICE_THREAD> inputDeviceThread;
+	Property<AutoTristate, CFGKEY_DISC_IMAGE_CACHE, {.defaultValue = AutoTristate::Off}> discImageCache;
 
 protected:
 	struct ConfigParams
@@ -393,7 +408,6 @@ protected:
 		Gfx::DrawableConfig windowDrawableConf;
 	};
 
-	[[no_unique_address]] IG::Data::PixmapWriter pixmapWriter;
 	[[no_unique_address]] PerformanceHintManager perfHintManager;
 	[[no_unique_address]] PerformanceHintSession perfHintSession;
 	ConditionalMember<MOGA_INPUT, std::unique_ptr<Input::MogaManager>> mogaManagerPtr;
@@ -20,8 +20,12 @@
 #include <imagine/time/Time.hh>
 #include <imagine/util/container/RingBuffer.hh>
 #include <imagine/util/used.hh>
+#include <imagine/util/DelegateFunc.hh>
 #include <memory>
 #include <atomic>
+#include <optional>
+#include <span>
+#include <vector>
 
 namespace IG
 {
@@ -72,6 +76,18 @@ public:
 	void close();
 	void flush();
 	void writeFrames(const void *samples, size_t framesToWrite);
+
+	// Returns space for up to maxFrames that a core can mix into directly, followed by
+	// commitWrite() with the frames actually written. The space is in the ring buffer
+	// unless it's nearly full or the speed multiplier requires resampling.
+	template<class T = uint8_t>
+	std::span<T> beginWrite(size_t maxFrames)
+	{
+		auto bytes = beginWriteBytes(maxFrames);
+		return {reinterpret_cast<T*>(bytes.data()), bytes.size() / sizeof(T)};
+	}
+
+	void commitWrite(size_t frames);
 	void setRate(int rate);
 	int rate() const { return rate_; }
 	int maxRate() const { return defaultRate; }
@@ -92,9 +108,14 @@ public:
 	bool readConfig(MapIO &, unsigned key);
 
 	IG::Audio::Manager manager;
+	// called on the emulation thread with the samples as the core wrote them, before any resampling
+	DelegateFunc<void (const void *samples, size_t frames)> onWriteFrames;
 protected:
 	IG::Audio::OutputStream audioStream;
-	RingBuffer<uint8_t, RingBufferConf{.mirrored = true}> rBuff;
+	using AudioRingBuffer = RingBuffer<uint8_t, RingBufferConf{.mirrored = true}>;
+	AudioRingBuffer rBuff;
+	std::optional<AudioRingBuffer::RWSpan> pendingWrite;
+	std::vector<uint8_t> stagingBuff;
 	SteadyClockTimePoint lastUnderrunTime{};
 	double speedMultiplier{1.};
 	size_t targetBufferFillBytes{};
@@ -120,6 +141,11 @@ public:
 	void resizeAudioBuffer(size_t targetBufferFillBytes);
 	void updateVolume();
 	void updateAddBuffersOnUnderrun();
+
+private:
+	std::span<uint8_t> beginWriteBytes(size_t maxFrames);
+	void updateWriteStateBeforeWrite();
+	void updateWriteStateAfterWrite(size_t bytes);
 };
 
 }
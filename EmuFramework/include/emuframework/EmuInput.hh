@@ -21,11 +21,14 @@
 #include <emuframework/ToggleInput.hh>
 #include <emuframework/inputDefs.hh>
 #include <imagine/input/inputDefs.hh>
+#include <imagine/input/KeyStateSnapshot.hh>
 #include <string>
 #include <string_view>
 #include <memory>
 #include <span>
 #include <algorithm>
+#include <vector>
+#include <mutex>
 
 namespace EmuEx
 {
@@ -195,6 +198,8 @@ public:
 	bool handleAppActionKeyInput(EmuApp&, InputAction, const Input::Event &srcEvent);
 	void handleSystemKeyInput(EmuApp&, KeyInfo, Input::Action, uint32_t metaState = 0, SystemKeyInputFlags flags = {});
 	void updateInputDevices(ApplicationContext);
+	void sampleLateInput(EmuApp&);
+	void updateTurboInput(EmuApp&);
 	KeyConfig *customKeyConfig(std::string_view name, const Input::Device &) const;
 	KeyConfigDesc keyConfig(std::string_view name, const Input::Device &) const;
 	void deleteKeyProfile(ApplicationContext, KeyConfig *);
@@ -217,6 +222,19 @@ public:
 	KeyInfo validateSystemKey(KeyInfo key, bool isUIKey) const;
 	void updateKeyboardMapping();
 	void toggleKeyboard();
+
+private:
+	struct SampledInputDevice
+	{
+		const Input::Device *devPtr;
+		const Input::KeyStateSnapshot *snapshot;
+		Input::KeyStateSnapshot::Keys keys{};
+		uint32_t sequence{};
+	};
+	std::vector<SampledInputDevice> sampledInputDevices;
+	// held while writing to the system's input state, recursive since toggle and turbo
+	// keys re-enter handleSystemKeyInput()
+	std::recursive_mutex systemInputMutex;
 };
 
 }
@@ -84,7 +84,9 @@ enum { CFGKEY_SOUND = 0, CFGKEY_TOUCH_CONTROL_DISPLAY = 1,
 	CFGKEY_RECENT_CONTENT_V2 = 116, CFGKEY_MAX_RECENT_CONTENT = 117,
 	CFGKEY_REWIND_STATES = 118, CFGKEY_REWIND_TIMER_SECS = 119,
 	CFGKEY_FRAME_CLOCK = 120, CFGKEY_INPUT_DEVICE_CONTENT_CONFIGS = 121,
-	CFGKEY_SHOW_FRAME_TIMING_STATS = 122
+	CFGKEY_SHOW_FRAME_TIMING_STATS = 122, CFGKEY_LOW_LATENCY_FRAME_PACING = 123,
+	CFGKEY_INPUT_DEVICE_THREAD = 124, CFGKEY_ARCHIVE_CACHE_SIZE = 125,
+	CFGKEY_ARCHIVE_CACHE_PATH = 126, CFGKEY_DISC_IMAGE_CACHE = 127
 	// 256+ is reserved
 };
 
@@ -104,8 +106,9 @@ constexpr const char *optionSavePathDefaultToken = ":DEFAULT:";
 
 constexpr double minRunSpeed = .05;
 constexpr double maxRunSpeed = 20.;
+constexpr double unlimitedRunSpeed = 0.; // run frames back-to-back as fast as the host allows
 
-constexpr bool isValidFastSpeed(const auto &v) { return v <= int(maxRunSpeed * 100.) && v > 100; }
+constexpr bool isValidFastSpeed(const auto &v) { return v == int(unlimitedRunSpeed) || (v <= int(maxRunSpeed * 100.) && v > 100); }
 constexpr bool isValidSlowSpeed(const auto &v) { return v >= int(minRunSpeed * 100.) && v < 100; }
 
 bool isValidAspectRatio(float val);
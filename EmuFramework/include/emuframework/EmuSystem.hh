@@ -36,6 +36,7 @@ class PixelFormat;
 class IO;
 class FileIO;
 class MapIO;
+class ThreadStop;
 }
 
 namespace IG::Input
@@ -82,6 +83,17 @@ struct BundledGameInfo
 	const char *assetName;
 };
 
+// Outcome of running one piece of content headless in a batch, the CRC of the
+// last frame lets runs be compared for regression testing
+struct BatchRunResult
+{
+	FS::PathString path;
+	std::string error;
+	SteadyClockDuration time{};
+	uint32_t frameCrc{};
+	int frames{};
+};
+
 struct EmuSystemCreateParams
 {
 	uint8_t systemFlags;
@@ -148,6 +160,7 @@ constexpr const char *optionUserPathContentToken = ":CONTENT:";
 struct SaveStateFlags
 {
 	uint8_t uncompressed:1{};
+	uint8_t transient:1{}; // only restored in the current session, data that can't change like ROMs may be omitted
 };
 
 class EmuSystem
@@ -207,6 +220,8 @@ public:
 	static F2Size validFrameRateRange;
 	static bool hasRectangularPixels;
 	static bool stateSizeChangesAtRuntime;
+	static bool usesGzipStates; // readState() accepts gzip compressed data in the uncompressed state format
+	static bool usesDiscImages; // loads CD images, shows the disc image cache option
 
 	EmuSystem(IG::ApplicationContext ctx): appCtx{ctx} {}
 
@@ -266,6 +281,9 @@ public:
 	bool removeCheat(Cheat&);
 	void forEachCheat(DelegateFunc<bool(Cheat&, std::string_view)>);
 	void forEachCheatCode(Cheat&, DelegateFunc<bool(CheatCode&, std::string_view)>);
+	// runs each content file in its own independent core instance, in parallel,
+	// files not yet started are skipped once a stop is requested
+	std::vector<BatchRunResult> runBatch(std::span<const FS::PathString> paths, int frames, const ThreadStop &);
 
 	ApplicationContext appContext() const { return appCtx; }
 	bool isActive() const { return state == State::ACTIVE; }
@@ -355,6 +373,7 @@ public:
 	void onBackupMemoryWritten(BackupMemoryDirtyFlags flags = 0xFF);
 	bool updateBackupMemoryCounter();
 	bool usesBackupMemory() const;
+	bool canRunBatch() const;
 	FileIO openStaticBackupMemoryFile(CStringView uri, size_t staticSize, uint8_t initValue = 0) const;
 	void sessionOptionSet();
 	void resetSessionOptionsSet() { sessionOptionsSet = false; }
@@ -19,11 +19,13 @@
 #include <emuframework/EmuVideo.hh>
 #include <main/MainSystem.hh>
 #include <imagine/io/IO.hh>
+#include <imagine/util/ranges.hh>
 
 namespace EmuEx
 {
 
-// TODO: Make EmuSystem a template class instead of using static dispatching
+// Included only by each system's main translation unit, so every call below resolves to
+// MainSystem at compile time and the per-frame loops can inline the system's runFrame()
 
 FS::FileString EmuSystem::configName() const
 {
@@ -199,6 +201,38 @@ void EmuSystem::runFrame(EmuSystemTaskContext task, EmuVideo *video, EmuAudio *a
 	static_cast<MainSystem*>(this)->runFrame(task, video, audio);
 }
 
+void EmuSystem::runFrames(EmuSystemTaskContext taskCtx, EmuVideo *video, EmuAudio *audio, int frames)
+{
+	auto &sys = *static_cast<MainSystem*>(this);
+	for(auto _ : iotaCount(frames - 1))
+	{
+		sys.runFrame(taskCtx, nullptr, audio);
+	}
+	sys.runFrame(taskCtx, video, audio);
+	updateBackupMemoryCounter();
+}
+
+void EmuSystem::skipFrames(EmuSystemTaskContext taskCtx, int frames, EmuAudio *audio)
+{
+	assert(hasContent());
+	auto &sys = *static_cast<MainSystem*>(this);
+	for(auto _ : iotaCount(frames))
+	{
+		sys.runFrame(taskCtx, nullptr, audio);
+	}
+}
+
+SteadyClockDuration EmuSystem::benchmark(EmuVideo &video)
+{
+	auto &sys = *static_cast<MainSystem*>(this);
+	auto before = SteadyClock::now();
+	for(auto _ : iotaCount(180))
+	{
+		sys.runFrame({}, &video, nullptr);
+	}
+	return SteadyClock::now() - before;
+}
+
 size_t EmuSystem::stateSize()
 {
 	if(&MainSystem::stateSize != &EmuSystem::stateSize)
@@ -280,6 +314,18 @@ void EmuSystem::addThreadGroupIds(std::vector<ThreadId> &ids) const
 		static_cast<const MainSystem*>(this)->addThreadGroupIds(ids);
 }
 
+std::vector<BatchRunResult> EmuSystem::runBatch(std::span<const FS::PathString> paths, int frames, const ThreadStop &stop)
+{
+	if(&MainSystem::runBatch != &EmuSystem::runBatch)
+		return static_cast<MainSystem*>(this)->runBatch(paths, frames, stop);
+	return {};
+}
+
+bool EmuSystem::canRunBatch() const
+{
+	return &MainSystem::runBatch != &EmuSystem::runBatch;
+}
+
 Cheat* EmuSystem::newCheat(EmuApp& app, const char* name, CheatCodeDesc desc)
 {
 	if(&MainSystem::newCheat != &EmuSystem::newCheat)
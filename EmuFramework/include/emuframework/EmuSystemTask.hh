@@ -21,6 +21,8 @@
 #include <imagine/time/Time.hh>
 #include <imagine/util/variant.hh>
 #include <imagine/util/ScopeGuard.hh>
+#include <imagine/util/DelegateFunc.hh>
+#include <exception>
 
 namespace EmuEx
 {
@@ -42,6 +44,22 @@ private:
 	int totalFrameTimeCount{};
 };
 
+// Schedules the start of emulation as late as possible in the host frame, based on the
+// measured emulation time and a continuously updated host frame duration
+class FramePacer
+{
+public:
+	SteadyClockTimePoint emulationStartTime(FrameParams);
+	void reportWorkTime(SteadyClockDuration);
+	void reset() { *this = {}; }
+
+private:
+	static constexpr SteadyClockDuration minSafetyMargin{Milliseconds{4}};
+	SteadyClockDuration hostFrameDuration{};
+	SteadyClockDuration workTime{};
+	SteadyClockDuration safetyMargin{minSafetyMargin};
+};
+
 class EmuSystemTask
 {
 public:
@@ -97,11 +115,11 @@ public:
 	SuspendContext setWindow(Window&);
 	[[nodiscard]]
 	SuspendContext suspend();
+	void runOnThread(DelegateFunc<void()>);
 	void stop();
 	bool isStarted() const { return threadId_; }
 	void sendVideoFormatChangedReply(EmuVideo&);
 	void sendFrameFinishedReply(EmuVideo&);
-	void sendScreenshotReply(bool success);
 	auto threadId() const { return threadId_; }
 	Window &window(this auto&& self) { return *self.winPtr; }
 	Screen &screen(this auto&& self) { return *self.window().screen(); }
@@ -121,17 +139,23 @@ private:
 	ThreadId threadId_{};
 	std::binary_semaphore framePresentedSem{0};
 	std::binary_semaphore suspendSem{0};
+	std::binary_semaphore suspendedFuncDoneSem{0};
+	DelegateFunc<void()> suspendedFunc;
+	std::exception_ptr suspendedFuncException;
 	FrameRate hostFrameRate;
 	FrameRateConfig frameRateConfig;
 	int savedAdvancedFrames{};
 	FrameRateDetector frameRateDetector;
+	FramePacer framePacer;
 public:
 	bool enableBlankFrameInsertion{};
+	bool runUncapped{};
 private:
 	bool waitingForPresent_{};
 	bool isSuspended{};
 
 	void resume();
+	void waitWhileSuspended();
 	void addOnFrameDelayed();
 	void addOnFrame();
 	void removeOnFrame();
@@ -139,6 +163,8 @@ private:
 	IG::OnFrameDelegate onFrameDelayed(int8_t delay);
 	void addOnFrameDelegate(IG::OnFrameDelegate);
 	void setIntendedFrameRate(FrameRateConfig);
+	bool advanceFramesUncapped(FrameParams);
+	void runFramesUntilPresented(SteadyClockTimePoint deadline);
 	FrameRateConfig configFrameRate(const Screen&);
 	FrameRateConfig configFrameRate(const Screen&, std::span<const FrameRate> supportedRates);
 	void setWindowInternal(Window&);
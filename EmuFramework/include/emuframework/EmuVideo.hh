@@ -66,7 +66,7 @@ public:
 	void finishFrame(EmuSystemTaskContext, IG::PixmapView pix);
 	void dispatchFrameFinished() { onFrameFinished(*this); }
 	void clear();
-	void takeGameScreenshot();
+	void takeGameScreenshot(int frames = 1);
 	bool isExternalTexture() const;
 	Gfx::PixmapBufferTexture &image();
 	Gfx::Renderer &renderer() const;
@@ -91,11 +91,12 @@ public:
 protected:
 	IG::PixelFormat renderFmt;
 	Gfx::TextureBufferMode bufferMode{};
-	bool screenshotNextFrame{};
+	int16_t screenshotFrames{};
+	int16_t screenshotBurstIdx{};
 	Gfx::ColorSpace colSpace{Gfx::ColorSpace::LINEAR};
 	bool useLinearFilter{true};
 
-	void doScreenshot(EmuSystemTaskContext, IG::PixmapView pix);
+	void doScreenshot(IG::PixmapView pix);
 	void postFrameFinished(EmuSystemTaskContext);
 	Gfx::TextureSamplerConfig samplerConfig() const { return samplerConfigForLinearFilter(useLinearFilter); }
 
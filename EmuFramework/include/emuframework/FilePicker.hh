@@ -30,6 +30,7 @@ public:
 	FilePicker(ViewAttachParams, FSPicker::Mode, EmuSystem::NameFilterFunc, const Input::Event &, bool includeArchives = true);
 	FilePicker(ViewAttachParams, EmuApp &, FSPicker::Mode, EmuSystem::NameFilterFunc, const Input::Event &, bool includeArchives = true);
 	static std::unique_ptr<FilePicker> forBenchmarking(ViewAttachParams, const Input::Event &, bool singleDir = false);
+	static std::unique_ptr<FilePicker> forBatchRun(ViewAttachParams, const Input::Event &);
 	static std::unique_ptr<FilePicker> forLoading(ViewAttachParams, const Input::Event &, bool singleDir = false,
 		EmuSystemCreateParams params = {});
 	static std::unique_ptr<FilePicker> forMediaChange(ViewAttachParams, const Input::Event &,
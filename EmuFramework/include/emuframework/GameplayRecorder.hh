@@ -0,0 +1,131 @@
+#pragma once
+
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/io/FileIO.hh>
+#include <imagine/pixmap/Pixmap.hh>
+#include <imagine/audio/Format.hh>
+#include <imagine/time/Time.hh>
+#include <imagine/util/memory/DynArray.hh>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+struct z_stream_s;
+
+namespace EmuEx
+{
+
+using namespace IG;
+
+// Records emulated video & audio losslessly to an AVI file. Video uses ZMBV (the DOSBox
+// capture codec): each frame is XORed against the previous one in 16x16 blocks and deflated,
+// audio is stored as PCM. The emulation thread only copies each frame into a pooled buffer,
+// encoder threads compress frames in parallel as independent deflate segments, and a writer
+// thread muxes the finished chunks in submission order.
+class GameplayRecorder
+{
+public:
+	static constexpr int keyFrameInterval{300};
+	static constexpr int maxPendingFrames{16};
+
+	GameplayRecorder() = default;
+	~GameplayRecorder() { stop(); }
+	// start() & stop() must be called while the emulation thread is suspended
+	bool start(FileIO, FrameRate, PixmapDesc, Audio::Format);
+	// Returns false if any part of the file couldn't be written
+	bool stop();
+	bool isActive() const { return active; }
+	// Called from the emulation thread, frames are cropped or padded to the starting size
+	void addVideoFrame(PixmapView);
+	// Frames emulated without rendering, stored as unchanged frames to keep audio in sync
+	void addRepeatedFrames(int count);
+	// Frames emulated without audio output, stored as silence to keep audio in sync
+	void addSilence(int frames);
+	// Returns false the first time the format differs from the starting one, AVI can't
+	// change it mid-stream so the caller should end the recording
+	bool addAudio(std::span<const uint8_t> samples, Audio::Format);
+
+private:
+	struct Packet
+	{
+		DynArray<uint8_t> data;
+		uint32_t size{};
+		bool isAudio{};
+		bool isRepeat{};
+		bool isKeyFrame{};
+		bool isReady{};
+	};
+
+	struct EncodeJob
+	{
+		Packet *packet;
+		std::shared_ptr<uint8_t[]> frame, prevFrame; // no previous frame for key frames
+	};
+
+	struct IndexEntry
+	{
+		std::array<char, 4> id;
+		uint32_t flags, offset, size;
+	};
+
+	FileIO file;
+	PixmapDesc desc;
+	FrameRate frameRate;
+	Audio::Format audioFormat;
+	std::vector<std::thread> encodeThreads;
+	std::thread writeThread;
+	std::mutex mutex;
+	std::condition_variable jobCond;
+	std::condition_variable writeCond;
+	std::deque<Packet> packets;
+	std::deque<EncodeJob> jobs;
+	std::vector<DynArray<uint8_t>> freeOutBuffs;
+	std::vector<std::shared_ptr<uint8_t[]>> framePool;
+	std::shared_ptr<uint8_t[]> prevFrame;
+	std::vector<uint8_t> audioBuff;
+	DynArray<uint8_t> unchangedFrame;
+	std::vector<IndexEntry> index;
+	std::atomic_int pendingFrames{};
+	double pendingSilenceFrames{};
+	uint32_t videoFrames{};
+	uint32_t audioBytes{};
+	uint32_t moviBytes{};
+	int framesUntilKeyFrame{};
+	int droppedFrames{};
+	bool active{};
+	bool quit{};
+	bool writeError{};
+	bool fileFull{};
+	bool audioFormatChanged{};
+
+	std::shared_ptr<uint8_t[]> acquireFrame();
+	void flushAudio();
+	void queueRepeatedFrames(int count);
+	void encodeFrames();
+	uint32_t encodeFrame(z_stream_s &, DynArray<uint8_t> &work, DynArray<uint8_t> &out, const EncodeJob &) const;
+	void writePackets();
+	void writeChunk(std::array<char, 4> id, std::span<const uint8_t>, uint32_t flags);
+	void writeAviHeader();
+};
+
+}
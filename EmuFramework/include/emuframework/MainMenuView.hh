@@ -50,6 +50,7 @@ protected:
 	TextMenuItem onScreenInputManager;
 	TextMenuItem inputManager;
 	TextMenuItem benchmark;
+	TextMenuItem batchRun;
 	ConditionalMember<Config::Input::BLUETOOTH, TextMenuItem> scanWiimotes;
 	ConditionalMember<Config::Input::BLUETOOTH, TextMenuItem> bluetoothDisconnect;
 	ConditionalMember<Config::Bluetooth::server, TextMenuItem> acceptPS3ControllerConnection;
@@ -0,0 +1,75 @@
+#pragma once
+
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/base/ApplicationContext.hh>
+#include <imagine/data-type/image/PixmapWriter.hh>
+#include <imagine/pixmap/Pixmap.hh>
+#include <imagine/fs/FSDefs.hh>
+#include <imagine/util/memory/DynArray.hh>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace EmuEx
+{
+
+using namespace IG;
+
+// Encodes and writes screenshots on a worker thread so the emulation thread only pays
+// for copying the frame into a pooled buffer. Bursts of consecutive frames queue up to
+// maxPendingFrames, any beyond that are dropped instead of stalling emulation.
+class ScreenshotWriter
+{
+public:
+	static constexpr size_t maxPendingFrames{32};
+
+	ScreenshotWriter(ApplicationContext ctx): ctx{ctx}, pixmapWriter{ctx} {}
+	~ScreenshotWriter();
+	bool writeToFile(PixmapView pix, CStringView path) const { return pixmapWriter.writeToFile(pix, path); }
+	// Copies the frame and queues it for writing, the result message is posted after
+	// the last frame of a burst is written. Returns false if the frame was dropped, which
+	// also ends the burst and reports how many of its frames were written.
+	bool writeAsync(PixmapView, FS::PathString path, int burstIndex = -1, bool isLastInBurst = true);
+
+private:
+	struct Frame
+	{
+		PixmapDesc desc;
+		DynArray<uint8_t> buff;
+		FS::PathString path;
+		int burstIndex;
+		bool isLastInBurst;
+	};
+
+	ApplicationContext ctx;
+	[[no_unique_address]] Data::PixmapWriter pixmapWriter;
+	std::thread thread;
+	std::mutex mutex;
+	std::condition_variable cond;
+	std::deque<Frame> pending;
+	std::vector<DynArray<uint8_t>> freeBuffs;
+	int burstFramesWritten{};
+	bool burstFailed{};
+	bool quit{};
+
+	void run();
+	void postResult(bool success, int burstFrames);
+};
+
+}
@@ -32,7 +32,7 @@ public:
 	void onShow() override;
 	void loadStandardItems();
 
-	static constexpr int STANDARD_ITEMS = 11;
+	static constexpr int STANDARD_ITEMS = 12;
 	static constexpr int MAX_SYSTEM_ITEMS = 6;
 
 protected:
@@ -45,6 +45,7 @@ protected:
 	TextMenuItem inputOverrides;
 	ConditionalMember<Config::envIsAndroid, TextMenuItem> addLauncherIcon;
 	TextMenuItem screenshot;
+	TextMenuItem recording;
 	TextMenuItem resetSessionOptions;
 	TextMenuItem close;
 	StaticArrayList<MenuItem*, STANDARD_ITEMS + MAX_SYSTEM_ITEMS> item;
@@ -38,7 +38,7 @@ protected:
 	MultiChoiceMenuItem autosaveLaunch;
 	BoolMenuItem autosaveContent;
 	BoolMenuItem confirmOverwriteState;
-	TextMenuItem fastModeSpeedItem[6];
+	TextMenuItem fastModeSpeedItem[7];
 	MultiChoiceMenuItem fastModeSpeed;
 	TextMenuItem slowModeSpeedItem[3];
 	MultiChoiceMenuItem slowModeSpeed;
@@ -48,6 +48,8 @@ protected:
 	ConditionalMember<Config::envIsAndroid, BoolMenuItem> performanceMode;
 	ConditionalMember<Config::envIsAndroid && Config::DEBUG_BUILD, BoolMenuItem> noopThread;
 	ConditionalMember<Config::cpuAffinity, TextMenuItem> cpuAffinity;
+	TextMenuItem discImageCacheItem[3];
+	MultiChoiceMenuItem discImageCache;
 	TextHeadingMenuItem autosaveHeading;
 	TextHeadingMenuItem rewindHeading;
 	TextHeadingMenuItem otherHeading;
@@ -36,6 +36,7 @@ MDFN_CDROM_CPPFLAGS = -I$(EMUFRAMEWORK_PATH)/include/shared/lzma \
 MDFN_CDROM_SRC := mednafen-emuex/CDImpl.cc \
  mednafen-emuex/ArchiveVFS.cc \
  mednafen/cdrom/CDAFReader.cpp \
+ mednafen/cdrom/CDAFReader_DecodeAhead.cpp \
  mednafen/cdrom/CDAFReader_FLAC.cpp \
  mednafen/cdrom/CDAFReader_MPC.cpp \
  mednafen/cdrom/CDAFReader_PCM.cpp \
@@ -81,6 +82,7 @@ MDFN_CDROM_SRC := mednafen-emuex/CDImpl.cc \
 
 MDFN_CDROM_STANDALONE_SRC := $(MDFN_CDROM_SRC) \
  mednafen-emuex/MDFNApi.cc \
+ mednafen-emuex/MThreading.cc \
  mednafen-emuex/StreamImpl.cc \
  mednafen-emuex/VirtualFS.cpp \
  mednafen-emuex/MDFNFILE.cc \
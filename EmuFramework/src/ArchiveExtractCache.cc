@@ -0,0 +1,283 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <emuframework/ArchiveExtractCache.hh>
+#include <emuframework/RecentContent.hh>
+#include <emuframework/Option.hh>
+#include <emuframework/EmuOptions.hh>
+#include <imagine/fs/FS.hh>
+#include <imagine/fs/ArchiveFS.hh>
+#include <imagine/io/FileIO.hh>
+#include <imagine/thread/Thread.hh>
+#include <imagine/util/format.hh>
+#include <imagine/util/math.hh>
+#include <imagine/logger/logger.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace EmuEx
+{
+
+constexpr SystemLogger log{"ArchiveCache"};
+constexpr size_t extractChunkSize = 1024 * 1024;
+constexpr std::string_view tempSuffix{".tmp"};
+
+static uint64_t fnv1a(uint64_t hash, std::string_view data)
+{
+	for(auto c : data)
+	{
+		hash ^= uint8_t(c);
+		hash *= 0x100000001b3;
+	}
+	return hash;
+}
+
+FS::PathString ArchiveExtractCache::directory() const
+{
+	if(userDirectory.size())
+	{
+		if(!isUri(userDirectory))
+		{
+			try
+			{
+				FS::create_directory(userDirectory);
+				return FS::PathString{userDirectory};
+			}
+			catch(std::system_error &err)
+			{
+				log.error("can't use directory:{} ({})", userDirectory, err.what());
+			}
+		}
+		else
+		{
+			log.warn("can't use URI for cache directory:{}", userDirectory);
+		}
+	}
+	return FS::createDirectorySegments(ctx.cachePath(), "ArchiveCache");
+}
+
+FS::PathString ArchiveExtractCache::entryPath(ArchiveIO &entry, std::string_view archivePath, size_t archiveSize) const
+{
+	auto name = entry.name();
+	auto size = entry.size();
+	auto crc = entry.crc32();
+	uint64_t hash = fnv1a(0xcbf29ce484222325, name);
+	hash = fnv1a(hash, std::format("{}:{:08x}", size, crc));
+	if(!crc) // formats without a stored CRC fall back to identifying the archive file itself
+		hash = fnv1a(hash, std::format("{}:{}", archivePath, archiveSize));
+	auto ext = FS::basename(name);
+	auto dotPos = std::string_view{ext}.rfind('.');
+	return FS::pathString(directory(),
+		std::format("{:016x}{}", hash, dotPos != std::string_view::npos ? std::string_view{ext}.substr(dotPos) : std::string_view{}));
+}
+
+IO ArchiveExtractCache::open(ArchiveIO &entry, std::string_view archivePath, size_t archiveSize,
+	EmuSystem::OnLoadProgressDelegate onLoadProgress)
+{
+	if(!isEnabled())
+		return {};
+	stopPreExtract();
+	FS::PathString path;
+	try
+	{
+		path = entryPath(entry, archivePath, archiveSize);
+	}
+	catch(std::exception &err)
+	{
+		log.error("error accessing cache:{}", err.what());
+		return {};
+	}
+	if(FileIO cachedFile{path, {.test = true, .accessHint = IOAccessHint::Random}};
+		cachedFile && cachedFile.size() == entry.size())
+	{
+		log.info("using cached copy:{} of {}", path, entry.name());
+		FS::last_write_time(path, FS::file_time_type::clock::now());
+		return cachedFile;
+	}
+	if(entry.size() > maxSizeMiB * size_t(1024 * 1024))
+		return {};
+	FS::FileString name{entry.name()};
+	if(!extract(entry, path, onLoadProgress))
+	{
+		// entry data may be partially consumed, find it again from the start of the archive
+		entry.rewind();
+		FS::seekFileInArchive(entry, name);
+		return {};
+	}
+	evict(path);
+	return FileIO{path, {.test = true, .accessHint = IOAccessHint::Random}};
+}
+
+bool ArchiveExtractCache::extract(ArchiveIO &entry, CStringView path, EmuSystem::OnLoadProgressDelegate onLoadProgress)
+{
+	auto tempPath = FS::PathString{path};
+	tempPath += tempSuffix;
+	FileIO file{tempPath, OpenFlags::testNewFile()};
+	if(!file)
+		return false;
+	auto size = entry.size();
+	log.info("extracting {} ({} bytes) to:{}", entry.name(), size, path);
+	auto buff = std::make_unique_for_overwrite<uint8_t[]>(extractChunkSize);
+	int progressMax = divRoundUp(size, extractChunkSize);
+	if(onLoadProgress)
+		onLoadProgress(0, progressMax, "Extracting...");
+	size_t bytesWritten{};
+	auto removeTemp = [&]
+	{
+		file = {};
+		FS::remove(tempPath);
+		return false;
+	};
+	while(bytesWritten < size)
+	{
+		if(cancelExtract.load(std::memory_order_relaxed))
+			return removeTemp();
+		auto bytesRead = entry.read(buff.get(), extractChunkSize);
+		if(bytesRead <= 0)
+		{
+			log.error("error reading archive entry");
+			return removeTemp();
+		}
+		if(file.write(buff.get(), bytesRead) != bytesRead)
+		{
+			log.error("error writing:{}", tempPath);
+			return removeTemp();
+		}
+		bytesWritten += bytesRead;
+		if(onLoadProgress)
+			onLoadProgress(divRoundUp(bytesWritten, extractChunkSize), 0, nullptr);
+	}
+	file = {};
+	return FS::rename(tempPath, path);
+}
+
+void ArchiveExtractCache::evict(CStringView keepPath) const
+{
+	struct CachedFile
+	{
+		FS::PathString path;
+		FS::file_status status;
+	};
+	std::vector<CachedFile> files;
+	uint64_t totalSize{};
+	for(auto &e : FS::directory_iterator{directory()})
+	{
+		if(e.type() != FS::file_type::regular)
+			continue;
+		if(e.name().ends_with(tempSuffix)) // left over from an interrupted extraction
+		{
+			FS::remove(e.path());
+			continue;
+		}
+		auto status = FS::status(e.path());
+		totalSize += status.size();
+		files.emplace_back(e.path(), status);
+	}
+	const uint64_t maxSize = maxSizeMiB * uint64_t(1024 * 1024);
+	if(totalSize <= maxSize)
+		return;
+	std::ranges::sort(files, {}, [](auto &f){ return f.status.lastWriteTime(); });
+	for(auto &f : files)
+	{
+		if(totalSize <= maxSize)
+			break;
+		if(f.path == keepPath)
+			continue;
+		log.info("removing least recently used:{}", f.path);
+		if(FS::remove(f.path))
+			totalSize -= f.status.size();
+	}
+}
+
+void ArchiveExtractCache::startPreExtract(const RecentContent &recentContent)
+{
+	if(!isEnabled())
+		return;
+	stopPreExtract();
+	std::vector<FS::PathString> paths;
+	for(const auto &info : recentContent)
+	{
+		if(paths.size() == maxPreExtractEntries)
+			break;
+		if(FS::hasArchiveExtension(info.name))
+			paths.emplace_back(info.path);
+	}
+	if(paths.empty())
+		return;
+	cancelExtract = false;
+	preExtractThread = std::thread
+	{
+		[this, paths = std::move(paths)]
+		{
+			setThisThreadPriority(10);
+			for(const auto &path : paths)
+			{
+				if(cancelExtract.load(std::memory_order_relaxed))
+					return;
+				try
+				{
+					auto file = ctx.openFileUri(path, {.test = true, .accessHint = IOAccessHint::Sequential});
+					if(!file)
+						continue;
+					auto archiveSize = file.size();
+					for(auto &entry : FS::ArchiveIterator{std::move(file)})
+					{
+						if(entry.type() != FS::file_type::regular || !EmuSystem::defaultFsFilter(entry.name()))
+							continue;
+						auto cachedPath = entryPath(entry, path, archiveSize);
+						if(FS::exists(cachedPath) || entry.size() > maxSizeMiB * size_t(1024 * 1024))
+							break;
+						if(extract(entry, cachedPath, {}))
+							evict(cachedPath);
+						break;
+					}
+				}
+				catch(std::exception &err)
+				{
+					log.warn("error pre-extracting {}:{}", path, err.what());
+				}
+			}
+			log.info("finished pre-extracting recent content");
+		}
+	};
+}
+
+void ArchiveExtractCache::stopPreExtract()
+{
+	if(!preExtractThread.joinable())
+		return;
+	cancelExtract = true;
+	preExtractThread.join();
+	cancelExtract = false;
+}
+
+bool ArchiveExtractCache::readConfig(MapIO &io, unsigned key)
+{
+	switch(key)
+	{
+		default: return false;
+		case CFGKEY_ARCHIVE_CACHE_SIZE: return readOptionValue<uint32_t>(io, [&](auto s){ maxSizeMiB = s; });
+		case CFGKEY_ARCHIVE_CACHE_PATH: return readStringOptionValue(io, userDirectory);
+	}
+}
+
+void ArchiveExtractCache::writeConfig(FileIO &io) const
+{
+	writeOptionValueIfNotDefault(io, CFGKEY_ARCHIVE_CACHE_SIZE, maxSizeMiB, defaultMaxSizeMiB);
+	writeStringOptionValue(io, CFGKEY_ARCHIVE_CACHE_PATH, userDirectory);
+}
+
+}
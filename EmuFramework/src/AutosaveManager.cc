@@ -20,6 +20,8 @@
 #include "pathUtils.hh"
 #include <imagine/io/MapIO.hh>
 #include <imagine/io/FileIO.hh>
+#include <imagine/util/string/uri.hh>
+#include <imagine/util/zlib.hh>
 #include <imagine/logger/logger.h>
 
 namespace EmuEx
@@ -37,7 +39,7 @@ AutosaveManager::AutosaveManager(EmuApp &app_):
 		[this]
 		{
 			log.debug("running autosave timer");
-			save();
+			saveAsync();
 			saveTimer.update();
 			return true;
 		}
@@ -48,16 +50,85 @@ bool AutosaveManager::save(AutosaveActionSource src)
 	if(autoSaveSlot == noAutosaveName)
 		return true;
 	log.info("saving autosave slot:{}", autoSaveSlot);
+	waitForPendingSave();
 	system().flushBackupMemory(app);
 	if(saveOnlyBackupMemory && src == AutosaveActionSource::Auto)
 		return true;
 	return saveState();
 }
 
+static void writeStateFile(ApplicationContext ctx, CStringView path, std::span<const uint8_t> state)
+{
+	// write plain paths to a temporary file and rename it over the old state so an
+	// interrupted save never leaves a truncated file, content URIs are written in place
+	bool useTempFile = !isUri(path);
+	FS::PathString writePath{path};
+	if(useTempFile)
+		writePath += ".tmp";
+	{
+		auto io = ctx.openFileUri(writePath, OpenFlags::newFile());
+		if(io.write(state).bytes != ssize_t(state.size()))
+			throw std::runtime_error("Error writing autosave state");
+		io.sync();
+	}
+	if(useTempFile && !ctx.renameFileUri(writePath, path))
+		throw std::runtime_error("Error renaming autosave state");
+}
+
+// Takes an uncompressed snapshot while the emulation thread is suspended, then
+// compresses and writes it on a worker thread. Automatic saves are skipped if the
+// previous one is still in progress.
+bool AutosaveManager::saveAsync()
+{
+	if(autoSaveSlot == noAutosaveName)
+		return true;
+	if(saveThread.isWorking())
+	{
+		log.info("previous autosave still in progress, skipping");
+		return false;
+	}
+	log.info("saving autosave slot:{} in background", autoSaveSlot);
+	waitForPendingSave();
+	system().flushBackupMemory(app);
+	if(saveOnlyBackupMemory)
+		return true;
+	auto snapshot = dynArrayForOverwrite<uint8_t>(system().stateSize());
+	snapshot.trim(app.writeState(snapshot, {.uncompressed = true}));
+	stateIO = {};
+	saveThread.reset([&app = app, ctx = appContext(), path = statePath(), snapshot = std::move(snapshot),
+		compress = EmuSystem::usesGzipStates](WorkThread::Context)
+	{
+		try
+		{
+			if(compress)
+			{
+				auto compArr = dynArrayForOverwrite<uint8_t>(compressBound(snapshot.size()) + 18);
+				compArr.trim(compressGzip(compArr, snapshot, Z_DEFAULT_COMPRESSION));
+				writeStateFile(ctx, path, compArr);
+			}
+			else
+			{
+				writeStateFile(ctx, path, snapshot);
+			}
+			log.info("finished writing autosave state:{}", path);
+		}
+		catch(std::exception &err)
+		{
+			log.error("error in background autosave:{}", err.what());
+			ctx.runOnMainThread([&app = app](ApplicationContext)
+			{
+				app.postErrorMessage(4, "Error writing autosave state");
+			});
+		}
+	});
+	return true;
+}
+
 bool AutosaveManager::load(AutosaveActionSource src, LoadAutosaveMode mode)
 {
 	if(autoSaveSlot == noAutosaveName)
 		return true;
+	waitForPendingSave();
 	try
 	{
 		system().loadBackupMemory(app);
@@ -93,6 +164,15 @@ bool AutosaveManager::load(AutosaveActionSource src, LoadAutosaveMode mode)
 bool AutosaveManager::saveState()
 {
 	log.info("saving autosave state");
+	if(!stateIO) // closed by saveAsync() since the background write replaces the file
+	{
+		stateIO = appContext().openFileUri(statePath(), OpenFlags::testCreateFile());
+		if(!stateIO)
+		{
+			app.postErrorMessage(4, "Error opening autosave state");
+			return false;
+		}
+	}
 	stateIO.truncate(0);
 	auto state = app.saveState();
 	if(stateIO.write(state.span(), 0).bytes != ssize_t(state.size()))
@@ -77,6 +77,8 @@ void EmuApp::saveConfigFile(FileIO &io)
 	writeOptionValueIfNotDefault(io, useSustainedPerformanceMode);
 	writeOptionValueIfNotDefault(io, keepBluetoothActive);
 	writeOptionValueIfNotDefault(io, notifyOnInputDeviceChange);
+	writeOptionValueIfNotDefault(io, inputDeviceThread);
+	writeOptionValueIfNotDefault(io, discImageCache);
 	if(appContext().hasTranslucentSysUI() && !doesLayoutBehindSystemUI())
 		writeOptionValue(io, CFGKEY_LAYOUT_BEHIND_SYSTEM_UI, false);
 	writeOptionValueIfNotDefault(io, contentRotation);
@@ -91,6 +93,7 @@ void EmuApp::saveConfigFile(FileIO &io)
 	inputManager.vController.writeConfig(io);
 	autosaveManager.writeConfig(io);
 	rewindManager.writeConfig(io);
+	archiveCache.writeConfig(io);
 	audio.writeConfig(io);
 	videoLayer.writeConfig(io);
 	if(overrideScreenFrameRate)
@@ -110,6 +113,7 @@ void EmuApp::saveConfigFile(FileIO &io)
 	inputManager.writeCustomKeyConfigs(io);
 	inputManager.writeSavedInputDevices(appContext(), io);
 	writeOptionValueIfNotDefault(io, showFrameTimingStats);
+	writeOptionValueIfNotDefault(io, lowLatencyFramePacing);
 }
 
 EmuApp::ConfigParams EmuApp::loadConfigFile(IG::ApplicationContext ctx)
@@ -159,6 +163,8 @@ EmuApp::ConfigParams EmuApp::loadConfigFile(IG::ApplicationContext ctx)
 						return true;
 					if(rewindManager.readConfig(io, key))
 						return true;
+					if(archiveCache.readConfig(io, key))
+						return true;
 					if(audio.readConfig(io, key))
 						return true;
 					if(recentContent.readConfig(io, key, system()))
@@ -196,6 +202,8 @@ EmuApp::ConfigParams EmuApp::loadConfigFile(IG::ApplicationContext ctx)
 				case CFGKEY_FAST_MODE_SPEED: return readOptionValue(io, fastModeSpeed);
 				case CFGKEY_SLOW_MODE_SPEED: return readOptionValue(io, slowModeSpeed);
 				case CFGKEY_NOTIFY_INPUT_DEVICE_CHANGE: return readOptionValue(io, notifyOnInputDeviceChange);
+				case CFGKEY_INPUT_DEVICE_THREAD: return readOptionValue(io, inputDeviceThread);
+				case CFGKEY_DISC_IMAGE_CACHE: return EmuSystem::usesDiscImages && readOptionValue(io, discImageCache);
 				case CFGKEY_MOGA_INPUT_SYSTEM:
 					return MOGA_INPUT ? readOptionValue<bool>(io, [&](auto on){setMogaManagerActive(on, false);}) : false;
 				case CFGKEY_TEXTURE_BUFFER_MODE: return readOptionValue(io, textureBufferMode);
@@ -233,6 +241,7 @@ EmuApp::ConfigParams EmuApp::loadConfigFile(IG::ApplicationContext ctx)
 				case CFGKEY_INPUT_KEY_CONFIGS_V2: return inputManager.readCustomKeyConfig(io);
 				case CFGKEY_INPUT_DEVICE_CONFIGS: return inputManager.readSavedInputDevices(io);
 				case CFGKEY_SHOW_FRAME_TIMING_STATS: return readOptionValue(io, showFrameTimingStats);
+				case CFGKEY_LOW_LATENCY_FRAME_PACING: return readOptionValue(io, lowLatencyFramePacing);
 			}
 			return false;
 		});
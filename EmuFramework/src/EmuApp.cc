@@ -51,6 +51,7 @@
 #include <imagine/bluetooth/BluetoothInputDevice.hh>
 #include <imagine/input/android/MogaManager.hh>
 #include <cmath>
+#include <unistd.h>
 
 namespace EmuEx
 {
@@ -71,7 +72,8 @@ EmuApp::EmuApp(ApplicationInitParams initParams, ApplicationContext &ctx):
 	assetManager{ctx},
 	vibrationManager{ctx},
 	bluetoothAdapter{ctx},
-	pixmapWriter{ctx},
+	archiveCache{ctx},
+	screenshotWriter{ctx},
 	perfHintManager{ctx.performanceHintManager()},
 	layoutBehindSystemUI{ctx.hasTranslucentSysUI()}
 {
@@ -160,6 +162,7 @@ static void suspendEmulation(EmuApp &app)
 void EmuApp::closeSystem()
 {
 	systemTask.stop();
+	stopRecording();
 	showUI();
 	system().closeRuntimeSystem(*this);
 	autosaveManager.resetSlot();
@@ -334,6 +337,10 @@ void EmuApp::mainInitCommon(IG::ApplicationInitParams initParams, IG::Applicatio
 	if(!renderer.supportsColorSpace())
 		windowDrawableConfig.colorSpace = {};
 	applyOSNavStyle(ctx, false);
+	if(inputDeviceThread)
+		ctx.setInputDeviceThread(true);
+	if(!EmuSystem::handlesArchiveFiles) // the cache isn't used by systems that read archives themselves
+		archiveCache.startPreExtract(recentContent);
 
 	ctx.addOnResume(
 		[this](IG::ApplicationContext, [[maybe_unused]] bool focused)
@@ -355,6 +362,9 @@ void EmuApp::mainInitCommon(IG::ApplicationInitParams initParams, IG::Applicatio
 					ctx.addNotification(title, title, system().contentDisplayName());
 				}
 			}
+			archiveCache.stopPreExtract();
+			if(!backgrounded)
+				batchRunThread.stop(ThreadStop::QUIT);
 			audio.close();
 			audio.manager.endSession();
 			saveConfigFile(ctx);
@@ -659,6 +669,60 @@ void EmuApp::runBenchmarkOneShot(EmuVideo &video)
 	postMessage(2, 0, std::format("{:.2f} fps", 180. / timeSecs.count()));
 }
 
+void EmuApp::runBatchOneShot(CStringView dirUri)
+{
+	if(batchRunThread.isWorking())
+	{
+		postErrorMessage("A batch run is already in progress");
+		return;
+	}
+	std::vector<FS::PathString> paths;
+	appContext().forEachInDirectoryUri(dirUri,
+		[&](auto &entry)
+		{
+			if(entry.type() != FS::file_type::directory && EmuSystem::defaultFsFilter(entry.name()))
+				paths.emplace_back(entry.path());
+			return true;
+		});
+	if(paths.empty())
+	{
+		postErrorMessage("No content in folder");
+		return;
+	}
+	// started from the menu so emulation is already paused, startEmulation() keeps
+	// it that way until the batch finishes since the batch uses every core
+	postMessage(std::format("Running {} in batch...", paths.size()));
+	batchRunThread.reset(
+		[this, paths = std::move(paths)](WorkThread::Context ctx)
+		{
+			constexpr int frames = 600;
+			log.info("starting batch run of {} files", paths.size());
+			auto before = SteadyClock::now();
+			auto results = system().runBatch(paths, frames, ctx.stop);
+			if(ctx.stop.isQuitting())
+				return;
+			auto totalSecs = duration_cast<FloatSeconds>(SteadyClock::now() - before);
+			size_t errors{};
+			for(const auto &r : results)
+			{
+				if(r.error.size())
+				{
+					errors++;
+					log.error("{}: {}", r.path, r.error);
+					continue;
+				}
+				auto secs = duration_cast<FloatSeconds>(r.time);
+				log.info("{}: {} frames in {} ({:.2f} fps), last frame crc:{:08X}",
+					r.path, r.frames, secs, r.frames / secs.count(), r.frameCrc);
+			}
+			log.info("batch run done in:{}", totalSecs);
+			appContext().runOnMainThread([this, count = results.size(), errors, totalSecs](ApplicationContext)
+			{
+				postMessage(4, errors, std::format("Ran {} in {:.2f}s, {} failed", count, totalSecs.count(), errors));
+			});
+		});
+}
+
 void EmuApp::showEmulation()
 {
 	if(viewController().isShowingEmulation() || !system().hasContent())
@@ -675,6 +739,11 @@ void EmuApp::startEmulation()
 {
 	if(!viewController().isShowingEmulation())
 		return;
+	if(batchRunThread.isWorking()) [[unlikely]]
+	{
+		postMessage("Emulation resumes after the batch run finishes");
+		return;
+	}
 	videoLayer.setBrightnessScale(1.f);
 	video.onFrameFinished = [&, &viewController = viewController()](EmuVideo&)
 	{
@@ -787,13 +856,68 @@ void EmuApp::unpostMessage()
 	viewController().popup.clear();
 }
 
-void EmuApp::printScreenshotResult(bool success)
+void EmuApp::printScreenshotResult(bool success, int burstFrames)
 {
+	if(burstFrames >= 0)
+	{
+		postMessage(3, !success, std::format("{} {} burst screenshots at {}",
+			success ? "Wrote" : "Error, only wrote", burstFrames,
+			appContext().formatDateAndTime(WallClock::now())));
+		return;
+	}
 	postMessage(3, !success, std::format("{}{}",
 		success ? "Wrote screenshot at " : "Error writing screenshot at ",
 		appContext().formatDateAndTime(WallClock::now())));
 }
 
+void EmuApp::startRecording()
+{
+	static constexpr std::string_view subDirName = "recordings";
+	auto &sys = system();
+	auto userPath = sys.userPath(userScreenshotPath);
+	sys.createContentLocalDirectory(userPath, subDirName);
+	auto path = sys.contentLocalDirectory(userPath, subDirName,
+		appContext().formatDateAndTimeAsFilename(WallClock::now()).append(".avi"));
+	auto file = appContext().openFileUri(path, OpenFlags::testNewFile());
+	if(!file)
+	{
+		postErrorMessage("Error creating recording file");
+		return;
+	}
+	auto suspendCtx = suspendEmulationThread();
+	auto videoFmt = video.renderPixelFormat();
+	if(!recorder.start(std::move(file), sys.frameRate(), {video.size(), videoFmt}, audio ? audio.format() : Audio::Format{}))
+	{
+		appContext().removeFileUri(path);
+		postErrorMessage("Error starting recording");
+		return;
+	}
+	audio.onWriteFrames = [this](const void *samples, size_t frames)
+	{
+		auto format = audio.format();
+		if(!recorder.addAudio({static_cast<const uint8_t*>(samples), format.framesToBytes(frames)}, format)) [[unlikely]]
+		{
+			// end the file since its audio stream can't switch formats
+			appContext().runOnMainThread([this](ApplicationContext)
+			{
+				stopRecording();
+				postErrorMessage("Recording ended since the audio format changed");
+			});
+		}
+	};
+	postMessage(std::format("Recording to {}", appContext().fileUriDisplayName(path)));
+}
+
+void EmuApp::stopRecording()
+{
+	if(!recorder.isActive())
+		return;
+	auto suspendCtx = suspendEmulationThread();
+	audio.onWriteFrames = {};
+	auto success = recorder.stop();
+	postMessage(3, !success, success ? "Finished recording" : "Error writing recording");
+}
+
 void EmuApp::createSystemWithMedia(IO io, CStringView path, std::string_view displayName,
 	const Input::Event &e, EmuSystemCreateParams params, ViewAttachParams attachParams,
 	CreateSystemCompleteDelegate onComplete)
@@ -996,8 +1120,11 @@ void EmuApp::resetInput()
 
 void EmuApp::setRunSpeed(double speed)
 {
-	assumeExpr(speed > 0.);
+	assumeExpr(speed >= 0.);
 	auto _ = suspendEmulationThread();
+	systemTask.runUncapped = speed == unlimitedRunSpeed;
+	if(systemTask.runUncapped)
+		speed = maxRunSpeed;
 	system().frameDurationMultiplier = 1. / speed;
 	audio.setSpeedMultiplier(speed);
 	systemTask.updateFrameRate();
@@ -1131,17 +1258,18 @@ void EmuApp::updateFrameRate() { systemTask.updateFrameRate(); }
 
 bool EmuApp::writeScreenshot(IG::PixmapView pix, CStringView path)
 {
-	return pixmapWriter.writeToFile(pix, path);
+	return screenshotWriter.writeToFile(pix, path);
 }
 
-FS::PathString EmuApp::makeNextScreenshotFilename()
+FS::PathString EmuApp::makeNextScreenshotFilename(int burstIndex)
 {
 	static constexpr std::string_view subDirName = "screenshots";
 	auto &sys = system();
 	auto userPath = sys.userPath(userScreenshotPath);
 	sys.createContentLocalDirectory(userPath, subDirName);
 	return sys.contentLocalDirectory(userPath, subDirName,
-		appContext().formatDateAndTimeAsFilename(WallClock::now()).append(".png"));
+		burstIndex < 0 ? appContext().formatDateAndTimeAsFilename(WallClock::now()).append(".png") :
+		std::format("{}-{:03}.png", appContext().formatDateAndTimeAsFilename(WallClock::now()), burstIndex));
 }
 
 void EmuApp::setMogaManagerActive(bool on, bool notify)
@@ -1369,6 +1497,24 @@ bool EmuApp::cpuAffinity(int cpuNumber) const
 	return doIfUsed(cpuAffinityMask, [&](auto &cpuAffinityMask) { return cpuAffinityMask & bit(cpuNumber); }, false);
 }
 
+uint64_t EmuApp::discImageMemCacheMaxSize() const
+{
+	switch(discImageCache.value())
+	{
+		case AutoTristate::Off: return 0;
+		case AutoTristate::On: return ~uint64_t{};
+		case AutoTristate::Auto: break;
+	}
+	// preload images using up to a quarter of physical memory
+	#ifdef _SC_PHYS_PAGES
+	auto pages = sysconf(_SC_PHYS_PAGES);
+	auto pageSize = sysconf(_SC_PAGESIZE);
+	if(pages > 0 && pageSize > 0)
+		return uint64_t(pages) * uint64_t(pageSize) / 4;
+	#endif
+	return 0;
+}
+
 std::unique_ptr<View> EmuApp::makeView(ViewAttachParams attach, ViewID id)
 {
 	auto view = makeCustomView(attach, id);
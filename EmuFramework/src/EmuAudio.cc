@@ -251,11 +251,8 @@ void EmuAudio::flush()
 	rBuff.clear();
 }
 
-void EmuAudio::writeFrames(const void *samples, size_t framesToWrite)
+void EmuAudio::updateWriteStateBeforeWrite()
 {
-	if(!framesToWrite) [[unlikely]]
-		return;
-	assumeExpr(rBuff.capacity());
 	auto inputFormat = format();
 	switch(audioWriteState)
 	{
@@ -274,6 +271,33 @@ void EmuAudio::writeFrames(const void *samples, size_t framesToWrite)
 		default:
 		break;
 	}
+}
+
+void EmuAudio::updateWriteStateAfterWrite(size_t bytes)
+{
+	if(audioWriteState == AudioWriteState::BUFFER && shouldStartAudioWrites(bytes))
+	{
+		if(Config::DEBUG_BUILD)
+		{
+			auto inputFormat = format();
+			auto bytes = rBuff.size();
+			auto capacity = rBuff.capacity();
+			log.info("starting audio writes with buffer fill {}/{} bytes {}/{} secs",
+				bytes, capacity, inputFormat.bytesToTime(bytes), inputFormat.bytesToTime(capacity));
+		}
+		audioWriteState = AudioWriteState::ACTIVE;
+	}
+}
+
+void EmuAudio::writeFrames(const void *samples, size_t framesToWrite)
+{
+	if(!framesToWrite) [[unlikely]]
+		return;
+	assumeExpr(rBuff.capacity());
+	if(onWriteFrames) [[unlikely]]
+		onWriteFrames(samples, framesToWrite);
+	auto inputFormat = format();
+	updateWriteStateBeforeWrite();
 	const size_t sampleFrames = framesToWrite;
 	if(speedMultiplier != 1.) [[unlikely]]
 	{
@@ -305,17 +329,46 @@ void EmuAudio::writeFrames(const void *samples, size_t framesToWrite)
 		}
 		rBuff.endWrite(span);
 	}
-	if(audioWriteState == AudioWriteState::BUFFER && shouldStartAudioWrites(bytes))
+	updateWriteStateAfterWrite(bytes);
+}
+
+std::span<uint8_t> EmuAudio::beginWriteBytes(size_t maxFrames)
+{
+	assumeExpr(rBuff.capacity());
+	assert(!pendingWrite);
+	auto bytes = format().framesToBytes(maxFrames);
+	// any buffer resize happens here so the span stays valid until commitWrite()
+	updateWriteStateBeforeWrite();
+	if(speedMultiplier == 1.)
 	{
-		if(Config::DEBUG_BUILD)
+		auto span = rBuff.beginWrite(bytes);
+		if(span.size() == bytes)
 		{
-			auto bytes = rBuff.size();
-			auto capacity = rBuff.capacity();
-			log.info("starting audio writes with buffer fill {}/{} bytes {}/{} secs",
-				bytes, capacity, inputFormat.bytesToTime(bytes), inputFormat.bytesToTime(capacity));
+			pendingWrite = span;
+			return span;
 		}
-		audioWriteState = AudioWriteState::ACTIVE;
 	}
+	if(stagingBuff.size() < bytes)
+		stagingBuff.resize(bytes);
+	return {stagingBuff.data(), bytes};
+}
+
+void EmuAudio::commitWrite(size_t frames)
+{
+	if(!pendingWrite)
+	{
+		writeFrames(stagingBuff.data(), frames);
+		return;
+	}
+	auto span = *std::exchange(pendingWrite, {});
+	auto bytes = format().framesToBytes(frames);
+	assert(bytes <= span.size());
+	if(!bytes) [[unlikely]]
+		return;
+	if(onWriteFrames) [[unlikely]]
+		onWriteFrames(span.data(), frames);
+	rBuff.endWrite({span.first(bytes), span.idxs});
+	updateWriteStateAfterWrite(bytes);
 }
 
 void EmuAudio::setRate(int newRate)
@@ -28,6 +28,7 @@ namespace EmuEx
 {
 
 constexpr SystemLogger log{"InputManager"};
+constexpr int screenshotBurstFrames{30};
 
 bool InputManager::handleKeyInput(EmuApp& app, KeyInfo keyInfo, const Input::Event &srcEvent)
 {
@@ -140,6 +141,13 @@ bool InputManager::handleAppActionKeyInput(EmuApp& app, InputAction action, cons
 			app.video.takeGameScreenshot();
 			return true;
 		}
+		case takeScreenshotBurst:
+		{
+			if(!isPushed)
+				break;
+			app.video.takeGameScreenshot(screenshotBurstFrames);
+			return true;
+		}
 		case toggleFastForward:
 		{
 			if(!isPushed)
@@ -226,6 +234,7 @@ bool InputManager::handleAppActionKeyInput(EmuApp& app, InputAction action, cons
 
 void InputManager::handleSystemKeyInput(EmuApp& app, KeyInfo keyInfo, Input::Action act, uint32_t metaState, SystemKeyInputFlags flags)
 {
+	std::scoped_lock lock{systemInputMutex};
 	if(flags.allowTurboModifier && turboModifierActive && std::ranges::all_of(keyInfo.codes, app.allowsTurboModifier))
 		keyInfo.flags.turbo = 1;
 	if(keyInfo.flags.toggle)
@@ -248,15 +257,92 @@ void InputManager::handleSystemKeyInput(EmuApp& app, KeyInfo keyInfo, Input::Act
 
 void InputManager::updateInputDevices(ApplicationContext ctx)
 {
+	auto suspendCtx = EmuApp::get(ctx).suspendEmulationThread();
+	sampledInputDevices.clear();
 	for(auto &devPtr : ctx.inputDevices())
 	{
 		log.info("input device:{}, id:{}, map:{}", devPtr->name(), devPtr->enumId(), (int)devPtr->map());
 		devPtr->makeAppData<InputDeviceData>(*this, *devPtr);
+		if(auto snapshot = devPtr->keyStateSnapshot(); snapshot)
+		{
+			auto seq = snapshot->sequence();
+			sampledInputDevices.emplace_back(devPtr.get(), snapshot, snapshot->keys(), seq);
+		}
 	}
 	vController.setPhysicalControlsPresent(ctx.keyInputIsPresent());
 	onUpdateDevices.callCopySafe();
 }
 
+static bool isLateSampleable(const InputDeviceData::ActionGroup &group)
+{
+	for(auto keyInfo : group)
+	{
+		if(!keyInfo)
+			break;
+		if(keyInfo.flags.appCode || keyInfo.flags.turbo || keyInfo.flags.toggle)
+			return false;
+	}
+	return true;
+}
+
+void InputManager::sampleLateInput(EmuApp& app)
+{
+	// Apply key changes from devices read on the input thread right before running the frame,
+	// the main thread still handles the same events later, which is harmless for plain system keys.
+	// Groups with app, combo, turbo, or toggle keys are left to the main thread entirely.
+	// If the main thread is writing input, sampling is retried next frame since it may be
+	// waiting for this thread to suspend.
+	std::unique_lock lock{systemInputMutex, std::try_to_lock};
+	if(!lock || turboModifierActive)
+		return;
+	for(auto &sampled : sampledInputDevices)
+	{
+		auto seq = sampled.snapshot->sequence();
+		if(seq == sampled.sequence)
+			continue;
+		sampled.sequence = seq;
+		auto keys = sampled.snapshot->keys();
+		const auto &actionTable = inputDevData(*sampled.devPtr).actionTable;
+		auto applyKey = [&](Input::Key key, Input::Action act)
+		{
+			if(key >= actionTable.size())
+				return;
+			const auto &group = actionTable[key];
+			if(!isLateSampleable(group))
+				return;
+			for(auto keyInfo : group)
+			{
+				if(!keyInfo)
+					break;
+				for(auto code : keyInfo.codes)
+				{
+					app.system().handleInputAction(&app, {code, keyInfo.flags, act});
+				}
+			}
+		};
+		for(auto key : sampled.keys)
+		{
+			if(key && !std::ranges::contains(keys, key))
+				applyKey(key, Input::Action::RELEASED);
+		}
+		for(auto key : keys)
+		{
+			if(key && !std::ranges::contains(sampled.keys, key))
+				applyKey(key, Input::Action::PUSHED);
+		}
+		sampled.keys = keys;
+	}
+}
+
+void InputManager::updateTurboInput(EmuApp& app)
+{
+	// called on the emulation thread, skipped like sampleLateInput() if the main thread is writing input
+	std::unique_lock lock{systemInputMutex, std::try_to_lock};
+	if(!lock)
+		return;
+	turboActions.update(app);
+}
+
 KeyConfig* InputManager::customKeyConfig(std::string_view name, const Input::Device &dev) const
 {
 	return findPtr(customKeyConfigs, [&](auto &ptr){ return ptr->name == name && ptr->desc().map == dev.map(); });
@@ -662,6 +748,7 @@ std::string_view toString(AppKeyCode code)
 		case AppKeyCode::incStateSlot: return "Increment State Slot";
 		case AppKeyCode::fastForward: return "Fast-forward";
 		case AppKeyCode::takeScreenshot: return "Take Screenshot";
+		case AppKeyCode::takeScreenshotBurst: return "Take Screenshot Burst";
 		case AppKeyCode::openMenu: return "Open Menu";
 		case AppKeyCode::toggleFastForward: return "Toggle Fast-forward";
 		case AppKeyCode::turboModifier: return "Turbo Modifier";
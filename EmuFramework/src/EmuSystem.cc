@@ -55,6 +55,8 @@ constexpr SystemLogger log{"EmuSystem"};
 [[gnu::weak]] F2Size EmuSystem::validFrameRateRange{minFrameRate, 80.};
 [[gnu::weak]] bool EmuSystem::hasRectangularPixels = false;
 [[gnu::weak]] bool EmuSystem::stateSizeChangesAtRuntime = false;
+[[gnu::weak]] bool EmuSystem::usesGzipStates = false;
+[[gnu::weak]] bool EmuSystem::usesDiscImages = false;
 
 bool EmuSystem::stateExists(int slot) const
 {
@@ -320,16 +322,6 @@ void EmuSystem::start(EmuApp &app)
 	app.rewindManager.startTimer();
 }
 
-SteadyClockDuration EmuSystem::benchmark(EmuVideo& video)
-{
-	auto before = SteadyClock::now();
-	for(auto _ : iotaCount(180))
-	{
-		runFrame({}, &video, nullptr);
-	}
-	return SteadyClock::now() - before;
-}
-
 void EmuSystem::configFrameRate(int outputRate, FrameDuration outputFrameDuration)
 {
 	if(!hasContent())
@@ -426,6 +418,7 @@ void EmuSystem::loadContentFromFile(IO file, CStringView path, std::string_view
 	{
 		IO io{};
 		FS::FileString originalName{};
+		auto archiveSize = file.size();
 		for(auto &entry : FS::ArchiveIterator{std::move(file)})
 		{
 			if(entry.type() == FS::file_type::directory)
@@ -437,7 +430,11 @@ void EmuSystem::loadContentFromFile(IO file, CStringView path, std::string_view
 			if(EmuSystem::defaultFsFilter(name))
 			{
 				originalName = name;
-				io = std::move(entry);
+				if(auto cachedIO = EmuApp::get(appContext()).archiveCache.open(entry, path, archiveSize, onLoadProgress);
+					cachedIO)
+					io = std::move(cachedIO);
+				else
+					io = std::move(entry);
 				break;
 			}
 		}
@@ -599,22 +596,6 @@ FileIO EmuSystem::openStaticBackupMemoryFile(CStringView uri, size_t size, uint8
 	return file;
 }
 
-void EmuSystem::runFrames(EmuSystemTaskContext taskCtx, EmuVideo *video, EmuAudio *audio, int frames)
-{
-	skipFrames(taskCtx, frames - 1, audio);
-	runFrame(taskCtx, video, audio);
-	updateBackupMemoryCounter();
-}
-
-void EmuSystem::skipFrames(EmuSystemTaskContext taskCtx, int frames, EmuAudio *audio)
-{
-	assert(hasContent());
-	for(auto _ : iotaCount(frames))
-	{
-		runFrame(taskCtx, nullptr, audio);
-	}
-}
-
 bool EmuSystem::skipForwardFrames(EmuSystemTaskContext taskCtx, int frames)
 {
 	for(auto i : iotaCount(frames))
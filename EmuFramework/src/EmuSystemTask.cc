@@ -31,11 +31,23 @@ EmuSystemTask::EmuSystemTask(EmuApp& app_):
 	{
 		[this](FrameParams params)
 		{
+			bool usePacer = app.lowLatencyFramePacing && app.frameInterval <= 1
+				&& app.system().frameDurationMultiplier == 1. && !enableBlankFrameInsertion;
+			if(usePacer)
+				std::this_thread::sleep_until(framePacer.emulationStartTime(params));
+			if(app.inputDeviceThread)
+				app.inputManager.sampleLateInput(app);
+			auto startFrameTime = SteadyClock::now();
 			bool renderingFrame = advanceFrames(params);
+			if(usePacer)
+				framePacer.reportWorkTime(SteadyClock::now() - startFrameTime);
 			if(renderingFrame)
 			{
 				app.record(FrameTimingStatEvent::waitForPresent);
-				framePresentedSem.acquire();
+				if(runUncapped) [[unlikely]]
+					runFramesUntilPresented(params.time + params.duration);
+				else
+					framePresentedSem.acquire();
 				auto endFrameTime = SteadyClock::now();
 				app.reportFrameWorkTime(endFrameTime - params.time);
 				app.record(FrameTimingStatEvent::endOfFrame, endFrameTime);
@@ -80,7 +92,7 @@ void EmuSystemTask::start(Window& win)
 							setWindowInternal(*cmd.winPtr);
 							assumeExpr(msg.semPtr);
 							msg.semPtr->release();
-							suspendSem.acquire();
+							waitWhileSuspended();
 							return true;
 						},
 						[&](SuspendCommand&)
@@ -89,7 +101,7 @@ void EmuSystemTask::start(Window& win)
 							isSuspended = true;
 							assumeExpr(msg.semPtr);
 							msg.semPtr->release();
-							suspendSem.acquire();
+							waitWhileSuspended();
 							return true;
 						},
 						[&](ExitCommand&)
@@ -138,7 +150,7 @@ void EmuSystemTask::setWindowInternal(Window& win)
 
 EmuSystemTask::SuspendContext EmuSystemTask::suspend()
 {
-	if(!isStarted() || isSuspended)
+	if(!isStarted() || isSuspended || threadId_ == thisThreadId()) // input actions may request it from the emulation thread itself
 		return {};
 	log.info("suspending emulation thread");
 	commandPort.send({.command = SuspendCommand{}}, MessageReplyMode::wait);
@@ -146,6 +158,42 @@ EmuSystemTask::SuspendContext EmuSystemTask::suspend()
 	return {this};
 }
 
+// Runs the function on the emulation thread if it's started, for system state that must only be
+// touched from that thread, and waits for it to finish. Exceptions are passed back to the caller.
+void EmuSystemTask::runOnThread(DelegateFunc<void()> func)
+{
+	if(!isStarted() || threadId_ == thisThreadId())
+	{
+		func();
+		return;
+	}
+	auto suspendCtx = suspend();
+	suspendedFunc = func;
+	suspendSem.release();
+	suspendedFuncDoneSem.acquire();
+	if(suspendedFuncException)
+		std::rethrow_exception(std::exchange(suspendedFuncException, {}));
+}
+
+void EmuSystemTask::waitWhileSuspended()
+{
+	while(true)
+	{
+		suspendSem.acquire();
+		if(!suspendedFunc)
+			return;
+		try
+		{
+			std::exchange(suspendedFunc, {})();
+		}
+		catch(...)
+		{
+			suspendedFuncException = std::current_exception();
+		}
+		suspendedFuncDoneSem.release();
+	}
+}
+
 void EmuSystemTask::resume()
 {
 	if(!isStarted() || !isSuspended)
@@ -184,14 +232,6 @@ void EmuSystemTask::sendFrameFinishedReply(EmuVideo &video)
 	video.dispatchFrameFinished();
 }
 
-void EmuSystemTask::sendScreenshotReply(bool success)
-{
-	app.runOnMainThread([&app = app, success](ApplicationContext)
-	{
-		app.printScreenshotResult(success);
-	});
-}
-
 IG::OnFrameDelegate EmuSystemTask::onFrameCalibrate()
 {
 	frameRateDetector = {};
@@ -257,6 +297,7 @@ void EmuSystemTask::addOnFrame()
 {
 	addOnFrameDelegate(onFrameUpdate);
 	savedAdvancedFrames = 0;
+	framePacer.reset();
 }
 
 void EmuSystemTask::removeOnFrame()
@@ -346,6 +387,8 @@ bool EmuSystemTask::advanceFrames(FrameParams frameParams)
 	{
 		viewCtrl.presentTime = {};
 	}
+	if(runUncapped) [[unlikely]]
+		return advanceFramesUncapped(frameParams);
 	if(sys.shouldFastForward()) [[unlikely]]
 	{
 		// for skipping loading on disk-based computers
@@ -397,11 +440,50 @@ bool EmuSystemTask::advanceFrames(FrameParams frameParams)
 		waitingForPresent_ = true;
 	}
 	//log.debug("running {} frame(s), skip:{}", frameInfo.advanced, !videoPtr);
+	if(app.recorder.isActive()) [[unlikely]]
+	{
+		if(!audioPtr)
+			app.recorder.addSilence(frameInfo.advanced);
+		app.recorder.addRepeatedFrames(frameInfo.advanced - (videoPtr ? 1 : 0));
+	}
 	sys.runFrames({this}, videoPtr, audioPtr, frameInfo.advanced);
-	app.inputManager.turboActions.update(app);
+	app.inputManager.updateTurboInput(app);
 	return videoPtr;
 }
 
+bool EmuSystemTask::advanceFramesUncapped(FrameParams frameParams)
+{
+	// publish the most recent frame right away, runFramesUntilPresented() then keeps
+	// emulating without video or audio until the next host frame
+	app.record(FrameTimingStatEvent::startOfFrame, frameParams.time);
+	app.record(FrameTimingStatEvent::startOfEmulation);
+	waitingForPresent_ = true;
+	if(app.recorder.isActive()) [[unlikely]]
+		app.recorder.addSilence(1);
+	app.system().runFrames({this}, &app.video, nullptr, 1);
+	app.inputManager.updateTurboInput(app);
+	return true;
+}
+
+void EmuSystemTask::runFramesUntilPresented(SteadyClockTimePoint deadline)
+{
+	auto &sys = app.system();
+	int frames{};
+	bool presented{};
+	do
+	{
+		sys.skipFrames({this}, 1, nullptr);
+		frames++;
+		if(!presented)
+			presented = framePresentedSem.try_acquire();
+	} while(!presented || SteadyClock::now() < deadline);
+	if(app.recorder.isActive()) [[unlikely]]
+	{
+		app.recorder.addSilence(frames);
+		app.recorder.addRepeatedFrames(frames);
+	}
+}
+
 void EmuSystemTask::notifyWindowPresented()
 {
 	if(waitingForPresent_)
@@ -411,6 +493,39 @@ void EmuSystemTask::notifyWindowPresented()
 	}
 }
 
+SteadyClockTimePoint FramePacer::emulationStartTime(FrameParams params)
+{
+	if(!hasTime(params.lastTime) || !hostFrameDuration.count())
+	{
+		hostFrameDuration = params.duration;
+		return params.time;
+	}
+	if(params.elapsedFrames() > 1)
+	{
+		// missed a frame, back off quickly
+		safetyMargin = std::min(safetyMargin * 2, hostFrameDuration / 2);
+		return params.time;
+	}
+	// track the actual host refresh with a slow moving average, ignoring outliers
+	auto frameDuration = params.time - params.lastTime;
+	if(std::chrono::abs(frameDuration - params.duration) < params.duration / 10)
+		hostFrameDuration += (frameDuration - hostFrameDuration) / 32;
+	safetyMargin = std::max(minSafetyMargin, safetyMargin - Microseconds{20});
+	auto delay = hostFrameDuration - workTime - safetyMargin;
+	if(delay < Milliseconds{1})
+		return params.time;
+	return params.time + delay;
+}
+
+void FramePacer::reportWorkTime(SteadyClockDuration time)
+{
+	// rise immediately on spikes, decay slowly so a single fast frame doesn't cause a miss
+	if(time > workTime)
+		workTime = time;
+	else
+		workTime -= (workTime - time) / 16;
+}
+
 std::optional<SteadyClockDuration> FrameRateDetector::run(SteadyClockTimePoint frameTime, SteadyClockDuration slack, SteadyClockDuration screenFrameDuration)
 {
 	const int framesToTime = 360;
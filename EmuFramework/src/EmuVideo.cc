@@ -134,6 +134,10 @@ void EmuVideo::startFrameWithAltFormat(EmuSystemTaskContext taskCtx, IG::PixmapV
 
 void EmuVideo::startUnchangedFrame(EmuSystemTaskContext taskCtx)
 {
+	if(taskCtx && app().recorder.isActive()) [[unlikely]]
+	{
+		app().recorder.addRepeatedFrames(1);
+	}
 	postFrameFinished(taskCtx);
 }
 
@@ -147,9 +151,13 @@ void EmuVideo::postFrameFinished(EmuSystemTaskContext taskCtx)
 
 void EmuVideo::finishFrame(EmuSystemTaskContext taskCtx, Gfx::LockedTextureBuffer texBuff)
 {
-	if(screenshotNextFrame) [[unlikely]]
+	if(screenshotFrames) [[unlikely]]
+	{
+		doScreenshot(texBuff.pixmap());
+	}
+	if(taskCtx && app().recorder.isActive()) [[unlikely]]
 	{
-		doScreenshot(taskCtx, texBuff.pixmap());
+		app().recorder.addVideoFrame(texBuff.pixmap());
 	}
 	vidImg.unlock(texBuff);
 	postFrameFinished(taskCtx);
@@ -157,9 +165,13 @@ void EmuVideo::finishFrame(EmuSystemTaskContext taskCtx, Gfx::LockedTextureBuffe
 
 void EmuVideo::finishFrame(EmuSystemTaskContext taskCtx, IG::PixmapView pix)
 {
-	if(screenshotNextFrame) [[unlikely]]
+	if(screenshotFrames) [[unlikely]]
+	{
+		doScreenshot(pix);
+	}
+	if(taskCtx && app().recorder.isActive()) [[unlikely]]
 	{
-		doScreenshot(taskCtx, pix);
+		app().recorder.addVideoFrame(pix);
 	}
 	vidImg.write(pix, {.async = true});
 	postFrameFinished(taskCtx);
@@ -172,23 +184,21 @@ void EmuVideo::clear()
 	vidImg.clear();
 }
 
-void EmuVideo::takeGameScreenshot()
+void EmuVideo::takeGameScreenshot(int frames)
 {
-	screenshotNextFrame = true;
+	screenshotBurstIdx = 0;
+	screenshotFrames = frames;
 }
 
-void EmuVideo::doScreenshot(EmuSystemTaskContext taskCtx, IG::PixmapView pix)
+void EmuVideo::doScreenshot(IG::PixmapView pix)
 {
-	screenshotNextFrame = false;
-	auto success = app().writeScreenshot(pix, app().makeNextScreenshotFilename());
-	if(taskCtx)
-	{
-		taskCtx.task().sendScreenshotReply(success);
-	}
-	else
-	{
-		app().printScreenshotResult(success);
-	}
+	bool isBurst = screenshotFrames > 1 || screenshotBurstIdx;
+	screenshotFrames--;
+	bool isLastFrame = !screenshotFrames;
+	int burstIdx = isBurst ? screenshotBurstIdx++ : -1;
+	// encoding happens on the screenshot writer's thread, which also reports the result
+	if(!app().screenshotWriter.writeAsync(pix, app().makeNextScreenshotFilename(burstIdx), burstIdx, isLastFrame))
+		screenshotFrames = 0;
 }
 
 bool EmuVideo::isExternalTexture() const
@@ -0,0 +1,542 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <emuframework/GameplayRecorder.hh>
+#include <imagine/thread/Thread.hh>
+#include <imagine/util/math.hh>
+#include <imagine/util/ranges.hh>
+#include <imagine/logger/logger.h>
+#include <zlib.h>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace EmuEx
+{
+
+constexpr SystemLogger log{"Recorder"};
+constexpr int blockSize = 16;
+constexpr size_t aviHeaderSize = 512;
+constexpr uint32_t aviKeyFrameFlag = 0x10;
+constexpr uint32_t maxMoviBytes = 0xF0000000; // keep the RIFF sizes within 32 bits
+constexpr std::array<char, 4> videoChunkId{'0', '0', 'd', 'c'}, audioChunkId{'0', '1', 'w', 'b'};
+
+// ZMBV frame header values
+constexpr uint8_t zmbvKeyFrame = 1;
+constexpr uint8_t zmbvCompressionZlib = 1;
+constexpr uint8_t zmbvFormat16Bpp = 6;
+constexpr uint8_t zmbvFormat32Bpp = 8;
+
+static bool initDeflate(z_stream &strm)
+{
+	// raw deflate so each frame is an independent segment that can be compressed on any thread,
+	// ending every segment with a sync flush lets them concatenate into one valid zlib stream
+	return deflateInit2(&strm, Z_BEST_SPEED, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+}
+
+static uint32_t deflateSegment(z_stream &strm, std::span<const uint8_t> in, std::span<uint8_t> out)
+{
+	deflateReset(&strm);
+	strm.next_in = const_cast<Bytef*>(in.data());
+	strm.avail_in = in.size();
+	strm.next_out = out.data();
+	strm.avail_out = out.size();
+	deflate(&strm, Z_SYNC_FLUSH);
+	assert(!strm.avail_in);
+	return out.size() - strm.avail_out;
+}
+
+static size_t maxSegmentSize(z_stream &strm, size_t bytes) { return deflateBound(&strm, bytes) + 16; }
+
+static WSize blocks(WSize size) { return {divRoundUp(size.x, blockSize), divRoundUp(size.y, blockSize)}; }
+
+static size_t vectorTableBytes(WSize size)
+{
+	auto b = blocks(size);
+	return (b.x * b.y * 2 + 3) & ~3;
+}
+
+template<class P>
+static size_t encodeDelta(std::span<uint8_t> work, const P *frame, const P *prevFrame, WSize size)
+{
+	auto vectorBytes = vectorTableBytes(size);
+	std::fill_n(work.data(), vectorBytes, 0);
+	auto vector = work.data();
+	auto xorData = reinterpret_cast<P*>(work.data() + vectorBytes);
+	auto blockCount = blocks(size);
+	for(int by = 0; by < blockCount.y; by++)
+	{
+		for(int bx = 0; bx < blockCount.x; bx++, vector += 2)
+		{
+			int x = bx * blockSize;
+			int y = by * blockSize;
+			int w = std::min(blockSize, size.x - x);
+			int h = std::min(blockSize, size.y - y);
+			size_t lineOffset = y * size.x + x;
+			bool changed{};
+			for(int row = 0; row < h; row++)
+			{
+				if(std::memcmp(&frame[lineOffset + row * size.x], &prevFrame[lineOffset + row * size.x], w * sizeof(P)))
+				{
+					changed = true;
+					break;
+				}
+			}
+			if(!changed)
+				continue;
+			// motion vectors are always 0, only the changed flag is set
+			vector[0] = 1;
+			for(int row = 0; row < h; row++)
+			{
+				auto src = &frame[lineOffset + row * size.x];
+				auto prevSrc = &prevFrame[lineOffset + row * size.x];
+				for(int col = 0; col < w; col++)
+				{
+					*xorData++ = src[col] ^ prevSrc[col];
+				}
+			}
+		}
+	}
+	return reinterpret_cast<uint8_t*>(xorData) - work.data();
+}
+
+bool GameplayRecorder::start(FileIO file_, FrameRate frameRate_, PixmapDesc desc_, Audio::Format audioFormat_)
+{
+	stop();
+	file = std::move(file_);
+	frameRate = frameRate_;
+	// ZMBV stores RGB565 or BGRX8888, other formats are converted while copying frames
+	desc = {desc_.size, desc_.format == PixelFmtRGB565 ? PixelFmtRGB565 : PixelFmtBGRA8888};
+	audioFormat = audioFormat_;
+	videoFrames = audioBytes = moviBytes = {};
+	framesUntilKeyFrame = droppedFrames = 0;
+	pendingSilenceFrames = 0;
+	quit = writeError = fileFull = audioFormatChanged = false;
+	z_stream strm{};
+	if(!initDeflate(strm))
+	{
+		log.error("error initializing zlib");
+		file = {};
+		return false;
+	}
+	// a frame with no changed blocks, used for frames that weren't rendered
+	std::vector<uint8_t> vectors(vectorTableBytes(desc.size));
+	unchangedFrame.resetForOverwrite(1 + maxSegmentSize(strm, vectors.size()));
+	unchangedFrame[0] = 0;
+	unchangedFrame.trim(1 + deflateSegment(strm, vectors, unchangedFrame.span().subspan(1)));
+	deflateEnd(&strm);
+	std::array<uint8_t, aviHeaderSize> placeholderHeader{};
+	if(file.write(placeholderHeader.data(), placeholderHeader.size()) != ssize_t(placeholderHeader.size()))
+	{
+		log.error("error writing file");
+		file = {};
+		return false;
+	}
+	log.info("recording {}x{} {} video at {}Hz, audio:{}Hz {} channels", desc.w(), desc.h(), desc.format.name(),
+		frameRate.hz(), audioFormat.rate, audioFormat.channels);
+	auto threads = std::clamp(int(std::thread::hardware_concurrency()) - 1, 1, 4);
+	for([[maybe_unused]] auto i : iotaCount(threads))
+	{
+		encodeThreads.emplace_back([this]{ encodeFrames(); });
+	}
+	writeThread = std::thread{[this]{ writePackets(); }};
+	active = true;
+	return true;
+}
+
+bool GameplayRecorder::stop()
+{
+	if(!active)
+		return true;
+	active = false;
+	flushAudio();
+	{
+		std::scoped_lock lock{mutex};
+		quit = true;
+	}
+	jobCond.notify_all();
+	writeCond.notify_all();
+	for(auto &t : encodeThreads)
+	{
+		t.join();
+	}
+	encodeThreads.clear();
+	writeThread.join();
+	uint32_t indexBytes = index.size() * sizeof(IndexEntry);
+	std::array<char, 4> indexId{'i', 'd', 'x', '1'};
+	file.write(indexId.data(), indexId.size());
+	file.put(indexBytes);
+	if(file.write(reinterpret_cast<const uint8_t*>(index.data()), indexBytes) != ssize_t(indexBytes))
+		writeError = true;
+	writeAviHeader();
+	log.info("finished recording {} frames ({} dropped), {} bytes of audio", videoFrames, droppedFrames, audioBytes);
+	file = {};
+	framePool.clear();
+	prevFrame = {};
+	freeOutBuffs.clear();
+	index.clear();
+	audioBuff.clear();
+	return !writeError && !fileFull;
+}
+
+std::shared_ptr<uint8_t[]> GameplayRecorder::acquireFrame()
+{
+	for(const auto &frame : framePool)
+	{
+		if(frame.use_count() == 1) // only referenced by the pool
+		{
+			std::atomic_thread_fence(std::memory_order_acquire);
+			return frame;
+		}
+	}
+	return framePool.emplace_back(std::make_shared_for_overwrite<uint8_t[]>(desc.bytes()));
+}
+
+void GameplayRecorder::addVideoFrame(PixmapView pix)
+{
+	flushAudio();
+	if(!prevFrame)
+		framesUntilKeyFrame = 0;
+	if(pendingFrames.load(std::memory_order_relaxed) >= maxPendingFrames && framesUntilKeyFrame)
+	{
+		// encoding is falling behind, repeat the last frame instead of waiting
+		droppedFrames++;
+		queueRepeatedFrames(1);
+		return;
+	}
+	auto frame = acquireFrame();
+	MutablePixmapView framePix{desc, frame.get()};
+	if(pix.size() != desc.size) [[unlikely]]
+	{
+		std::fill_n(frame.get(), desc.bytes(), 0);
+		WSize size{std::min(pix.w(), desc.w()), std::min(pix.h(), desc.h())};
+		framePix = framePix.subView({}, size);
+		pix = pix.subView({}, size);
+	}
+	framePix.writeConverted(pix);
+	bool isKeyFrame = !framesUntilKeyFrame;
+	framesUntilKeyFrame = isKeyFrame ? keyFrameInterval - 1 : framesUntilKeyFrame - 1;
+	pendingFrames.fetch_add(1, std::memory_order_relaxed);
+	{
+		std::scoped_lock lock{mutex};
+		auto &packet = packets.emplace_back();
+		packet.isKeyFrame = isKeyFrame;
+		jobs.emplace_back(&packet, frame, isKeyFrame ? nullptr : std::move(prevFrame));
+	}
+	jobCond.notify_one();
+	prevFrame = std::move(frame);
+}
+
+void GameplayRecorder::addRepeatedFrames(int count)
+{
+	if(count <= 0)
+		return;
+	flushAudio();
+	queueRepeatedFrames(count);
+}
+
+void GameplayRecorder::queueRepeatedFrames(int count)
+{
+	if(!prevFrame) // nothing to repeat before the first key frame
+		return;
+	{
+		std::scoped_lock lock{mutex};
+		for([[maybe_unused]] auto i : iotaCount(count))
+		{
+			auto &packet = packets.emplace_back();
+			packet.isRepeat = true;
+			packet.isReady = true;
+		}
+	}
+	writeCond.notify_one();
+}
+
+void GameplayRecorder::addSilence(int frames)
+{
+	if(!audioFormat || audioFormatChanged || frames <= 0)
+		return;
+	// carry the fractional part so rates that aren't a multiple of the frame rate don't drift
+	pendingSilenceFrames += frames * audioFormat.rate / double(frameRate.hz());
+	auto sampleFrames = size_t(pendingSilenceFrames);
+	pendingSilenceFrames -= sampleFrames;
+	audioBuff.resize(audioBuff.size() + audioFormat.framesToBytes(sampleFrames)); // zero is silence for signed & float samples
+}
+
+bool GameplayRecorder::addAudio(std::span<const uint8_t> samples, Audio::Format format)
+{
+	if(!audioFormat || audioFormatChanged) // audio was off when recording started
+		return true;
+	if(format != audioFormat) [[unlikely]]
+	{
+		log.warn("audio format changed to {}Hz {} channels, ignoring further audio", format.rate, format.channels);
+		audioFormatChanged = true;
+		return false;
+	}
+	audioBuff.insert(audioBuff.end(), samples.begin(), samples.end());
+	return true;
+}
+
+void GameplayRecorder::flushAudio()
+{
+	if(audioBuff.empty())
+		return;
+	auto data = dynArrayForOverwrite<uint8_t>(audioBuff.size());
+	std::ranges::copy(audioBuff, data.data());
+	audioBuff.clear();
+	{
+		std::scoped_lock lock{mutex};
+		auto &packet = packets.emplace_back();
+		packet.size = data.size();
+		packet.data = std::move(data);
+		packet.isAudio = true;
+		packet.isReady = true;
+	}
+	writeCond.notify_one();
+}
+
+void GameplayRecorder::encodeFrames()
+{
+	setThisThreadPriority(5);
+	z_stream strm{};
+	if(!initDeflate(strm))
+	{
+		log.error("error initializing zlib");
+		return;
+	}
+	DynArray<uint8_t> work;
+	std::unique_lock lock{mutex};
+	while(true)
+	{
+		jobCond.wait(lock, [&]{ return quit || jobs.size(); });
+		if(jobs.empty())
+			break;
+		auto job = std::move(jobs.front());
+		jobs.pop_front();
+		DynArray<uint8_t> out;
+		if(freeOutBuffs.size())
+		{
+			out = std::move(freeOutBuffs.back());
+			freeOutBuffs.pop_back();
+		}
+		lock.unlock();
+		auto size = encodeFrame(strm, work, out, job);
+		job.frame = {};
+		job.prevFrame = {};
+		lock.lock();
+		job.packet->data = std::move(out);
+		job.packet->size = size;
+		job.packet->isReady = true;
+		writeCond.notify_one();
+	}
+	deflateEnd(&strm);
+}
+
+uint32_t GameplayRecorder::encodeFrame(z_stream &strm, DynArray<uint8_t> &work, DynArray<uint8_t> &out, const EncodeJob &job) const
+{
+	const size_t frameBytes = desc.bytes();
+	std::span<const uint8_t> data{job.frame.get(), frameBytes};
+	if(job.prevFrame)
+	{
+		if(work.size() < vectorTableBytes(desc.size) + frameBytes)
+			work.resetForOverwrite(vectorTableBytes(desc.size) + frameBytes);
+		size_t deltaBytes = desc.format == PixelFmtRGB565 ?
+			encodeDelta(work.span(), reinterpret_cast<const uint16_t*>(job.frame.get()), reinterpret_cast<const uint16_t*>(job.prevFrame.get()), desc.size) :
+			encodeDelta(work.span(), reinterpret_cast<const uint32_t*>(job.frame.get()), reinterpret_cast<const uint32_t*>(job.prevFrame.get()), desc.size);
+		data = work.span().first(deltaBytes);
+	}
+	constexpr size_t maxHeaderSize = 9;
+	auto maxSize = maxHeaderSize + maxSegmentSize(strm, data.size());
+	if(out.size() < maxSize)
+		out.resetForOverwrite(maxSize);
+	size_t headerSize{};
+	auto put = [&](uint8_t b){ out[headerSize++] = b; };
+	if(job.prevFrame)
+	{
+		put(0);
+	}
+	else
+	{
+		put(zmbvKeyFrame);
+		put(0); put(1); // version 0.1
+		put(zmbvCompressionZlib);
+		put(desc.format == PixelFmtRGB565 ? zmbvFormat16Bpp : zmbvFormat32Bpp);
+		put(blockSize); put(blockSize);
+		// key frames restart the decoder's zlib stream, later frames continue it
+		put(0x78); put(0x01);
+	}
+	return headerSize + deflateSegment(strm, data, out.span().subspan(headerSize));
+}
+
+void GameplayRecorder::writePackets()
+{
+	setThisThreadPriority(5);
+	std::unique_lock lock{mutex};
+	while(true)
+	{
+		writeCond.wait(lock, [&]{ return (packets.size() && packets.front().isReady) || (quit && packets.empty()); });
+		if(packets.empty())
+			break;
+		auto packet = std::move(packets.front());
+		packets.pop_front();
+		lock.unlock();
+		if(packet.isAudio)
+		{
+			writeChunk(audioChunkId, packet.data.span().first(packet.size), aviKeyFrameFlag); // PCM can be decoded from any chunk
+			if(!fileFull)
+				audioBytes += packet.size;
+		}
+		else
+		{
+			if(packet.isRepeat)
+				writeChunk(videoChunkId, unchangedFrame.span(), 0);
+			else
+				writeChunk(videoChunkId, packet.data.span().first(packet.size), packet.isKeyFrame ? aviKeyFrameFlag : 0);
+			if(!fileFull)
+				videoFrames++;
+			if(!packet.isRepeat)
+				pendingFrames.fetch_sub(1, std::memory_order_relaxed);
+		}
+		lock.lock();
+		if(!packet.isAudio && packet.data.size())
+			freeOutBuffs.emplace_back(std::move(packet.data));
+	}
+}
+
+void GameplayRecorder::writeChunk(std::array<char, 4> id, std::span<const uint8_t> data, uint32_t flags)
+{
+	if(fileFull)
+		return;
+	uint32_t paddedSize = (data.size() + 1) & ~1;
+	if(moviBytes + 8 + paddedSize > maxMoviBytes)
+	{
+		log.warn("reached maximum file size, no more data will be written");
+		fileFull = true;
+		return;
+	}
+	uint32_t size = data.size();
+	file.write(id.data(), id.size());
+	file.put(size);
+	if(file.write(data.data(), data.size()) != ssize_t(data.size()))
+		writeError = true;
+	if(paddedSize != size)
+		file.put(uint8_t{});
+	index.emplace_back(id, flags, moviBytes + 4, size);
+	moviBytes += 8 + paddedSize;
+}
+
+void GameplayRecorder::writeAviHeader()
+{
+	std::array<uint8_t, aviHeaderSize> header{};
+	size_t pos{};
+	auto putId = [&](const char *id){ std::copy_n(id, 4, &header[pos]); pos += 4; };
+	auto put32 = [&](uint32_t v){ std::memcpy(&header[pos], &v, 4); pos += 4; };
+	auto put16 = [&](uint16_t v){ std::memcpy(&header[pos], &v, 2); pos += 2; };
+	const bool hasAudio = bool(audioFormat);
+	const uint32_t frameNSecs = std::chrono::duration_cast<Nanoseconds>(frameRate.duration()).count();
+	const uint32_t indexBytes = 8 + index.size() * sizeof(IndexEntry);
+	putId("RIFF");
+	put32(aviHeaderSize + moviBytes - 8 + indexBytes);
+	putId("AVI ");
+	putId("LIST");
+	auto hdrlSizePos = pos;
+	put32(0);
+	putId("hdrl");
+	putId("avih");
+	put32(56);
+	put32(frameNSecs / 1000); // microseconds per frame
+	put32(0); // max bytes per second
+	put32(0); // padding granularity
+	put32(0x110); // has index, interleaved
+	put32(videoFrames);
+	put32(0); // initial frames
+	put32(hasAudio ? 2 : 1); // streams
+	put32(0); // suggested buffer size
+	put32(desc.w());
+	put32(desc.h());
+	put32(0); put32(0); put32(0); put32(0); // reserved
+	// video stream
+	putId("LIST");
+	put32(4 + 8 + 56 + 8 + 40);
+	putId("strl");
+	putId("strh");
+	put32(56);
+	putId("vids");
+	putId("ZMBV");
+	put32(0); // flags
+	put32(0); // priority & language
+	put32(0); // initial frames
+	put32(frameNSecs); // scale
+	put32(1'000'000'000); // rate, rate / scale = frames per second
+	put32(0); // start
+	put32(videoFrames); // length
+	put32(0); // suggested buffer size
+	put32(~0u); // quality
+	put32(0); // sample size
+	put32(0); put32(0); // frame rect
+	putId("strf");
+	put32(40);
+	put32(40); // BITMAPINFOHEADER size
+	put32(desc.w());
+	put32(desc.h());
+	put16(1); // planes
+	put16(desc.format.bitsPerPixel());
+	putId("ZMBV");
+	put32(desc.bytes());
+	put32(0); put32(0); // pixels per meter
+	put32(0); put32(0); // colors used & important
+	if(hasAudio)
+	{
+		const uint16_t blockAlign = audioFormat.bytesPerFrame();
+		putId("LIST");
+		put32(4 + 8 + 56 + 8 + 16);
+		putId("strl");
+		putId("strh");
+		put32(56);
+		putId("auds");
+		put32(0); // handler
+		put32(0); // flags
+		put32(0); // priority & language
+		put32(0); // initial frames
+		put32(blockAlign); // scale
+		put32(audioFormat.rate * blockAlign); // rate
+		put32(0); // start
+		put32(audioBytes / blockAlign); // length
+		put32(0); // suggested buffer size
+		put32(~0u); // quality
+		put32(blockAlign); // sample size
+		put32(0); put32(0); // frame rect
+		putId("strf");
+		put32(16);
+		put16(audioFormat.sample.isFloat() ? 3 : 1); // WAVE_FORMAT_IEEE_FLOAT or WAVE_FORMAT_PCM
+		put16(audioFormat.channels);
+		put32(audioFormat.rate);
+		put32(audioFormat.rate * blockAlign);
+		put16(blockAlign);
+		put16(audioFormat.sample.bits());
+	}
+	uint32_t hdrlSize = pos - hdrlSizePos - 4;
+	std::memcpy(&header[hdrlSizePos], &hdrlSize, 4);
+	// pad the rest of the reserved space so "movi" starts at a fixed offset
+	putId("JUNK");
+	put32(aviHeaderSize - 12 - pos - 4);
+	pos = aviHeaderSize - 12;
+	putId("LIST");
+	put32(moviBytes + 4);
+	putId("movi");
+	if(file.write(header.data(), header.size(), 0) != ssize_t(header.size()))
+		writeError = true;
+}
+
+}
@@ -72,7 +72,7 @@ void RewindManager::saveState(EmuApp &app)
 	//log.debug("saving rewind state index:{}", stateIdx);
 	auto &entry = stateEntries[stateIdx];
 	stateIdx = stateIdx + 1 == maxStates ? 0 : stateIdx + 1;
-	entry.size = app.writeState({entry.data, stateSize}, {.uncompressed = true});
+	entry.size = app.writeState({entry.data, stateSize}, {.uncompressed = true, .transient = true});
 }
 
 void RewindManager::rewindState(EmuApp &app)
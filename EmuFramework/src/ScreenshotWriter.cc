@@ -0,0 +1,117 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <emuframework/ScreenshotWriter.hh>
+#include <emuframework/EmuApp.hh>
+#include <imagine/thread/Thread.hh>
+#include <imagine/logger/logger.h>
+
+namespace EmuEx
+{
+
+constexpr SystemLogger log{"Screenshot"};
+
+ScreenshotWriter::~ScreenshotWriter()
+{
+	if(!thread.joinable())
+		return;
+	{
+		std::scoped_lock lock{mutex};
+		quit = true;
+	}
+	cond.notify_one();
+	thread.join();
+}
+
+bool ScreenshotWriter::writeAsync(PixmapView pix, FS::PathString path, int burstIndex, bool isLastInBurst)
+{
+	auto desc = pix.desc();
+	DynArray<uint8_t> buff;
+	{
+		std::scoped_lock lock{mutex};
+		if(pending.size() == maxPendingFrames)
+		{
+			log.warn("too many pending screenshots, dropping:{}", path);
+			if(pending.back().isLastInBurst)
+			{
+				// nothing from this burst is queued
+				postResult(false, burstIndex < 0 ? -1 : 0);
+			}
+			else
+			{
+				// end the burst at its last queued frame, which then reports the result
+				pending.back().isLastInBurst = true;
+				burstFailed = true;
+			}
+			return false;
+		}
+		if(freeBuffs.size())
+		{
+			buff = std::move(freeBuffs.back());
+			freeBuffs.pop_back();
+		}
+	}
+	if(buff.size() < desc.bytes())
+		buff.resetForOverwrite(desc.bytes());
+	MutablePixmapView{desc, buff.data()}.write(pix);
+	{
+		std::scoped_lock lock{mutex};
+		pending.emplace_back(desc, std::move(buff), std::move(path), burstIndex, isLastInBurst);
+		if(!thread.joinable())
+			thread = std::thread{[this]{ run(); }};
+	}
+	cond.notify_one();
+	return true;
+}
+
+void ScreenshotWriter::run()
+{
+	setThisThreadPriority(5);
+	std::unique_lock lock{mutex};
+	while(true)
+	{
+		cond.wait(lock, [&]{ return quit || pending.size(); });
+		if(pending.empty())
+			return;
+		auto frame = std::move(pending.front());
+		pending.pop_front();
+		lock.unlock();
+		auto success = pixmapWriter.writeToFile({frame.desc, frame.buff.data()}, frame.path);
+		if(success)
+			log.info("wrote:{}", frame.path);
+		else
+			log.error("error writing:{}", frame.path);
+		lock.lock();
+		burstFramesWritten += success;
+		burstFailed = burstFailed || !success;
+		if(frame.isLastInBurst)
+		{
+			postResult(!burstFailed, frame.burstIndex < 0 ? -1 : burstFramesWritten);
+			burstFramesWritten = 0;
+			burstFailed = false;
+		}
+		freeBuffs.emplace_back(std::move(frame.buff));
+	}
+}
+
+void ScreenshotWriter::postResult(bool success, int burstFrames)
+{
+	ctx.runOnMainThread([success, burstFrames](ApplicationContext ctx)
+	{
+		ctx.applicationAs<EmuApp>().printScreenshotResult(success, burstFrames);
+	});
+}
+
+}
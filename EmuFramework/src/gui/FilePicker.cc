@@ -83,6 +83,20 @@ std::unique_ptr<FilePicker> FilePicker::forBenchmarking(ViewAttachParams attach,
 	return picker;
 }
 
+std::unique_ptr<FilePicker> FilePicker::forBatchRun(ViewAttachParams attach, const Input::Event &e)
+{
+	auto &app = EmuApp::get(attach.appContext());
+	auto picker = std::make_unique<FilePicker>(attach, app, FSPicker::Mode::DIR, EmuSystem::NameFilterFunc{}, e);
+	picker->setPath(app.contentSearchPath, e);
+	picker->setOnSelectPath(
+		[&app](FSPicker &picker, CStringView path, std::string_view, const Input::Event &)
+		{
+			picker.dismiss();
+			app.runBatchOneShot(path);
+		});
+	return picker;
+}
+
 std::unique_ptr<FilePicker> FilePicker::forLoading(ViewAttachParams attach, const Input::Event &e,
 	bool singleDir, EmuSystemCreateParams params)
 {
@@ -242,6 +242,12 @@ FrameTimingView::FrameTimingView(ViewAttachParams attach):
 		app().allowBlankFrameInsertion,
 		[this](BoolMenuItem &item) { app().allowBlankFrameInsertion = item.flipBoolValue(*this); }
 	},
+	lowLatencyFramePacing
+	{
+		"Delay Emulation To Reduce Latency", attach,
+		app().lowLatencyFramePacing,
+		[this](BoolMenuItem &item) { app().lowLatencyFramePacing = item.flipBoolValue(*this); }
+	},
 	advancedHeading{"Advanced", attach}
 {
 	loadStockItems();
@@ -263,6 +269,7 @@ void FrameTimingView::loadStockItems()
 	if(used(presentationTime) && renderer().supportsPresentationTime())
 		item.emplace_back(&presentationTime);
 	item.emplace_back(&blankFrameInsertion);
+	item.emplace_back(&lowLatencyFramePacing);
 	if(used(screenFrameRate) && app().emuScreen().supportedFrameRates().size() > 1)
 		item.emplace_back(&screenFrameRate);
 }
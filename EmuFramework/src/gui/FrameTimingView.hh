@@ -53,8 +53,9 @@ protected:
 	ConditionalMember<Gfx::supportsPresentationTime, TextMenuItem> presentationTimeItems[3];
 	ConditionalMember<Gfx::supportsPresentationTime, MultiChoiceMenuItem> presentationTime;
 	BoolMenuItem blankFrameInsertion;
+	BoolMenuItem lowLatencyFramePacing;
 	TextHeadingMenuItem advancedHeading;
-	StaticArrayList<MenuItem*, 10> item;
+	StaticArrayList<MenuItem*, 11> item;
 
 	bool onFrameRateChange(VideoSystem, SteadyClockDuration);
 };
@@ -297,6 +297,16 @@ InputManagerOptionsView::InputManagerOptionsView(ViewAttachParams attach):
 			app().notifyOnInputDeviceChange = item.flipBoolValue(*this);
 		}
 	},
+	inputDeviceThread
+	{
+		"Read Gamepads On Input Thread", attach,
+		app().inputDeviceThread,
+		[this](BoolMenuItem &item)
+		{
+			app().inputDeviceThread = item.flipBoolValue(*this);
+			appContext().setInputDeviceThread(app().inputDeviceThread);
+		}
+	},
 	bluetoothHeading
 	{
 		"In-app Bluetooth Options", attach,
@@ -362,6 +372,10 @@ InputManagerOptionsView::InputManagerOptionsView(ViewAttachParams attach):
 	{
 		item.emplace_back(&notifyDeviceChange);
 	}
+	if(appContext().hasInputDeviceThread())
+	{
+		item.emplace_back(&inputDeviceThread);
+	}
 	if(used(bluetoothHeading))
 	{
 		item.emplace_back(&bluetoothHeading);
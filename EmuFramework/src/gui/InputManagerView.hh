@@ -79,6 +79,7 @@ public:
 private:
 	ConditionalMember<MOGA_INPUT, BoolMenuItem> mogaInputSystem;
 	ConditionalMember<Config::Input::DEVICE_HOTSWAP, BoolMenuItem> notifyDeviceChange;
+	ConditionalMember<Config::envIsLinux, BoolMenuItem> inputDeviceThread;
 	ConditionalMember<Config::Input::BLUETOOTH, TextHeadingMenuItem> bluetoothHeading;
 	ConditionalMember<Config::Input::BLUETOOTH && Config::BASE_CAN_BACKGROUND_APP, BoolMenuItem> keepBtActive;
 	ConditionalMember<Config::Bluetooth::scanTime, TextMenuItem> btScanSecsItem[5];
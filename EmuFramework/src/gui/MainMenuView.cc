@@ -135,6 +135,14 @@ MainMenuView::MainMenuView(ViewAttachParams attach, bool customMenu):
 			pushAndShow(FilePicker::forBenchmarking(attachParams(), e), e, false);
 		}
 	},
+	batchRun
+	{
+		"Batch Run Content Folder", attach,
+		[this](const Input::Event &e)
+		{
+			pushAndShowModal(FilePicker::forBatchRun(attachParams(), e), e);
+		}
+	},
 	scanWiimotes
 	{
 		"Scan for Wiimotes/iCP/JS1", attach,
@@ -328,6 +336,8 @@ void MainMenuView::loadStandardItems()
 		item.emplace_back(&bluetoothDisconnect);
 	}
 	item.emplace_back(&benchmark);
+	if(system().canRunBatch())
+		item.emplace_back(&batchRun);
 	item.emplace_back(&about);
 	item.emplace_back(&exitApp);
 }
@@ -181,6 +181,25 @@ SystemActionsView::SystemActionsView(ViewAttachParams attach, bool customMenu):
 				}), e);
 		}
 	},
+	recording
+	{
+		"Start Recording", attach,
+		[this]
+		{
+			if(!system().hasContent())
+				return;
+			if(app().recorder.isActive())
+			{
+				app().stopRecording();
+				recording.compile("Start Recording");
+			}
+			else
+			{
+				app().startRecording();
+				app().showEmulation();
+			}
+		}
+	},
 	resetSessionOptions
 	{
 		"Reset Saved Options", attach,
@@ -227,6 +246,7 @@ void SystemActionsView::onShow()
 	autosaveNow.setActive(app().autosaveManager.slotName() != noAutosaveName);
 	revertAutosave.setActive(app().autosaveManager.slotName() != noAutosaveName);
 	resetSessionOptions.setActive(app().hasSavedSessionOptions());
+	recording.compile(app().recorder.isActive() ? "Stop Recording" : "Start Recording");
 }
 
 void SystemActionsView::loadStandardItems()
@@ -244,6 +264,7 @@ void SystemActionsView::loadStandardItems()
 	if(used(addLauncherIcon))
 		item.emplace_back(&addLauncherIcon);
 	item.emplace_back(&screenshot);
+	item.emplace_back(&recording);
 	item.emplace_back(&resetSessionOptions);
 	item.emplace_back(&close);
 }
@@ -106,6 +106,7 @@ SystemOptionView::SystemOptionView(ViewAttachParams attach, bool customMenu):
 		{"4x",    attach, {.id = 400}},
 		{"8x",    attach, {.id = 800}},
 		{"16x",   attach, {.id = 1600}},
+		{"Unlimited", attach, {.id = int(unlimitedRunSpeed)}},
 		{"Custom Value", attach,
 			[this](const Input::Event &e)
 			{
@@ -130,7 +131,11 @@ SystemOptionView::SystemOptionView(ViewAttachParams attach, bool customMenu):
 		{
 			.onSetDisplayString = [this](auto, Gfx::Text& t)
 			{
-				t.resetString(std::format("{:g}x", app().altSpeedAsDouble(AltSpeedMode::fast)));
+				auto speed = app().altSpeedAsDouble(AltSpeedMode::fast);
+				if(speed == unlimitedRunSpeed)
+					t.resetString("Unlimited");
+				else
+					t.resetString(std::format("{:g}x", speed));
 				return true;
 			},
 			.defaultItemOnSelect = [this](TextMenuItem &item) { app().setAltSpeed(AltSpeedMode::fast, item.id); }
@@ -253,6 +258,21 @@ SystemOptionView::SystemOptionView(ViewAttachParams attach, bool customMenu):
 			pushAndShow(makeView<CPUAffinityView>(appContext().cpuCount()), e);
 		}
 	},
+	discImageCacheItem
+	{
+		{"Auto", attach, {.id = AutoTristate::Auto}},
+		{"Off",  attach, {.id = AutoTristate::Off}},
+		{"On",   attach, {.id = AutoTristate::On}},
+	},
+	discImageCache
+	{
+		"Preload Disc Image To RAM", attach,
+		MenuId{app().discImageCache.value()},
+		discImageCacheItem,
+		{
+			.defaultItemOnSelect = [this](TextMenuItem &item) { app().discImageCache = AutoTristate(item.id.val); }
+		},
+	},
 	autosaveHeading{"Autosave Options", attach},
 	rewindHeading{"Rewind Options", attach},
 	otherHeading{"Other Options", attach}
@@ -282,6 +302,8 @@ void SystemOptionView::loadStockItems()
 		item.emplace_back(&noopThread);
 	if(used(cpuAffinity) && appContext().cpuCount() > 1)
 		item.emplace_back(&cpuAffinity);
+	if(EmuSystem::usesDiscImages)
+		item.emplace_back(&discImageCache);
 }
 
 }
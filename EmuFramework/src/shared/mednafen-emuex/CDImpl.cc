@@ -14,16 +14,23 @@
 	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
 
 #include <mednafen/mednafen.h>
+#include <mednafen/MemoryStream.h>
 #include <mednafen/cdrom/CDAccess.h>
 #include <mednafen/cdrom/CDAccess_Image.h>
 #include <mednafen/cdrom/CDAccess_CCD.h>
 #include <mednafen/cdrom/CDAccess_CHD.h>
+#include <mednafen/cdrom/CDInterface_MT.h>
+#include <mednafen/cdrom/CDInterface_ST.h>
+#include <imagine/logger/logger.h>
+#include <algorithm>
 
 namespace Mednafen
 {
 
 using namespace CDUtility;
 
+constexpr IG::SystemLogger log{"CDImpl"};
+
 // Disk-image(rip) track/sector formats
 enum
 {
@@ -75,42 +82,67 @@ void CDAccess_Image::ImageOpenBinary(VirtualFS* vfs, const std::string& path, bo
 	GenerateTOC();
 }
 
-static int readSector(auto &cdAccess, uint8 *buf, int32 lba, uint32 size)
+void CDAccess::CopySectorData(uint8 *buf, const uint8 *raw, int format, uint32 size)
 {
-	uint8 data[2352 + 96]{};
-	int format = cdAccess.Read_Raw_Sector(data, lba);
 	switch(format)
 	{
 		case DI_FORMAT_AUDIO:
 		assert(size == 2352);
-		memcpy(buf, data, size);
+		memcpy(buf, raw, size);
 		break;
 
 		case DI_FORMAT_MODE1:
 		case DI_FORMAT_MODE1_RAW:
 		assert(size == 2048);
-		memcpy(buf, data + 12 + 3 + 1, size);
+		memcpy(buf, raw + 12 + 3 + 1, size);
 		break;
 
 		case DI_FORMAT_CDI_RAW:
-		memcpy(buf, data, size);
+		memcpy(buf, raw, size);
 		break;
 
 		case DI_FORMAT_MODE2:
 		case DI_FORMAT_MODE2_RAW:
-		memcpy(buf, data + 16, size);
+		memcpy(buf, raw + 16, size);
 		break;
 
 		case DI_FORMAT_MODE2_FORM1:
 		case DI_FORMAT_MODE2_FORM2:
-		memcpy(buf, data + 24, size);
+		memcpy(buf, raw + 24, size);
 		break;
 	}
+}
+
+static int readSector(auto &cdAccess, uint8 *buf, int32 lba, uint32 size)
+{
+	uint8 data[2352 + 96]{};
+	int format = cdAccess.Read_Raw_Sector(data, lba);
+	CDAccess::CopySectorData(buf, data, format, size);
 	return format;
 }
 
 int CDAccess_Image::Read_Sector(uint8 *buf, int32 lba, uint32 size)
 {
+	// Tracks that only store the user data(e.g. ISO) are read directly, skipping the raw sector's header and EDC/ECC generation
+	if(size == 2048 && lba >= 0 && lba < total_sectors)
+	{
+		for(int32 track = FirstTrack; track < (FirstTrack + NumTracks); track++)
+		{
+			CDRFILE_TRACK_INFO *ct = &Tracks[track];
+
+			if(lba < ct->LBA || lba >= (ct->LBA + ct->sectors))
+				continue;
+
+			if((ct->DIFormat == DI_FORMAT_MODE1 || ct->DIFormat == DI_FORMAT_MODE2_FORM1) && !ct->AReader)
+			{
+				long SeekPos = ct->FileOffset + (lba - ct->LBA) * (DI_Size_Table[ct->DIFormat] + (ct->SubchannelMode ? 96 : 0));
+
+				ct->fp->readAtPos(buf, 2048, SeekPos);
+				return ct->DIFormat;
+			}
+			break;
+		}
+	}
 	return readSector(*this, buf, lba, size);
 }
 
@@ -169,4 +201,75 @@ int CDAccess_CHD::Read_Sector(uint8 *buf, int32 lba, uint32 size)
 	return readSector(*this, buf, lba, size);
 }
 
+// Copies the stream into a MemoryStream, returning null on a short read so the original stays in use
+static Stream* makeMemoryStream(Stream &stream)
+{
+	std::unique_ptr<MemoryStream> memStream{new MemoryStream(stream.size(), -1)};
+	const uint64 size = memStream->map_size();
+	const uint64 bytesRead = stream.readAtPos(memStream->map(), size, 0);
+	if(bytesRead != size)
+	{
+		log.warn("read {} of {} bytes while caching disc image in memory, reading it from storage", bytesRead, size);
+		return nullptr;
+	}
+	return memStream.release();
+}
+
+void CDAccess_Image::Memcache()
+{
+	for(int32 track = FirstTrack; track < (FirstTrack + NumTracks); track++)
+	{
+		Stream *fp = Tracks[track].fp;
+		if(!Tracks[track].FirstFileInstance || !fp || dynamic_cast<MemoryStream*>(fp))
+			continue;
+		// a file shared with an audio reader must stay the same Stream object
+		if(std::ranges::any_of(Tracks, [&](auto &t){ return t.fp == fp && t.AReader; }))
+			continue;
+		Stream *memFp = makeMemoryStream(*fp);
+		if(!memFp)
+			continue;
+		for(auto &t : Tracks)
+		{
+			if(t.fp == fp)
+				t.fp = memFp;
+		}
+		delete fp;
+	}
+}
+
+void CDAccess_CCD::Memcache()
+{
+	if(Stream *memStream = makeMemoryStream(*img_stream))
+		img_stream.reset(memStream);
+}
+
+void CDAccess_CHD::Memcache()
+{
+	if(chd_precache(chd) != CHDERR_NONE)
+		throw MDFN_Error(0, _("Failed to pre-cache CHD image"));
+}
+
+CDInterface* CDInterface::OpenWithMemcacheLimit(VirtualFS* vfs, const std::string& path, uint64& memcache_budget, const uint64 affinity)
+{
+	if(vfs != &NVFS || memcache_budget == ~uint64{})
+		return Open(vfs, path, true, affinity);
+	std::unique_ptr<CDAccess> cda{CDAccess_Open(vfs, path, false)};
+	if(memcache_budget)
+	{
+		// use the uncompressed size from the TOC as an upper bound on the memory the image needs
+		TOC toc;
+		cda->Read_TOC(&toc);
+		uint64 rawSize = (uint64(toc.tracks[100].lba) + 150) * 2352;
+		if(rawSize <= memcache_budget)
+		{
+			log.info("caching disc image in memory, {} bytes", rawSize);
+			cda->Memcache();
+			memcache_budget -= rawSize;
+			return new CDInterface_ST(std::move(cda));
+		}
+		log.info("disc image size:{} exceeds remaining memory cache budget:{}, using prefetch thread", rawSize, memcache_budget);
+	}
+	return new CDInterface_MT(std::move(cda), affinity);
+}
+
 }
@@ -20,6 +20,7 @@
 #include <imagine/util/format.hh>
 #include <imagine/util/string.h>
 #include <imagine/util/zlib.hh>
+#include <imagine/logger/logger.h>
 #include <emuframework/EmuApp.hh>
 #include <mednafen/types.h>
 #include <mednafen/video/surface.h>
@@ -140,11 +141,11 @@ inline void runFrame(EmuSystem &sys, Mednafen::MDFNGI &mdfnGameInfo, EmuSystemTa
 	EmuVideo *videoPtr, MutablePixmapView pixView, EmuAudio *audioPtr, size_t maxAudioFrames, size_t maxLineWidths = 0)
 {
 	using namespace Mednafen;
-	int16 audioBuff[maxAudioFrames * 2];
 	EmulateSpecStruct espec{};
 	if(audioPtr)
 	{
-		espec.SoundBuf = audioBuff;
+		// core mixes directly into the audio buffer
+		espec.SoundBuf = audioPtr->beginWrite<int16>(maxAudioFrames).data();
 		espec.SoundBufMaxSize = maxAudioFrames;
 	}
 	espec.taskCtx = taskCtx;
@@ -159,8 +160,8 @@ inline void runFrame(EmuSystem &sys, Mednafen::MDFNGI &mdfnGameInfo, EmuSystemTa
 	mdfnGameInfo.Emulate(&espec);
 	if(audioPtr)
 	{
-		assert((unsigned)espec.SoundBufSize <= audioPtr->format().bytesToFrames(sizeof(audioBuff)));
-		audioPtr->writeFrames((uint8_t*)audioBuff, espec.SoundBufSize);
+		assert((size_t)espec.SoundBufSize <= maxAudioFrames);
+		audioPtr->commitWrite(espec.SoundBufSize);
 	}
 }
 
@@ -239,6 +240,12 @@ inline void clearCDInterfaces(std::vector<Mednafen::CDInterface *> &ifaces)
 {
 	for(auto cdIfPtr : ifaces)
 	{
+		if(auto stats = cdIfPtr->GetReadStats(); stats.reads)
+		{
+			constexpr IG::SystemLogger log{"CDInterface"};
+			log.info("sector reads:{} stalls:{} ({}us total, {}us max)",
+				stats.reads, stats.stalls, stats.stall_time_us, stats.max_stall_time_us);
+		}
 		delete cdIfPtr;
 	}
 	ifaces.clear();
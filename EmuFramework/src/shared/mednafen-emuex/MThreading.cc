@@ -108,6 +108,16 @@ bool Cond_Wait(Cond* cond, Mutex* mutex) noexcept
 	return true;
 }
 
+bool Cond_TimedWait(Cond* cond, Mutex* mutex, unsigned ms) noexcept
+{
+	assumeExpr(cond);
+	assumeExpr(mutex);
+	std::unique_lock<std::mutex> lock{*mutex, std::adopt_lock};
+	auto status = cond->wait_for(lock, std::chrono::milliseconds{ms});
+	lock.release();
+	return status == std::cv_status::no_timeout;
+}
+
 
 Sem* Sem_Create(void)
 {
@@ -35,6 +35,7 @@
 #endif
 
 #include "CDAFReader_PCM.h"
+#include "CDAFReader_DecodeAhead.h"
 
 namespace Mednafen
 {
@@ -49,7 +50,7 @@ CDAFReader::~CDAFReader()
 
 }
 
-CDAFReader* CDAFR_Open(Stream* fp)
+CDAFReader* CDAFR_Open(Stream* fp, bool decode_ahead)
 {
  static CDAFReader* (* const OpenFuncs[])(Stream* fp) =
  {
@@ -66,7 +67,23 @@ CDAFReader* CDAFR_Open(Stream* fp)
   try
   {
    fp->rewind();
-   return f(fp);
+   CDAFReader* ret = f(fp);
+
+   // PCM reads are just a file read, no point in buffering them.
+   if(decode_ahead && f != CDAFR_PCM_Open)
+   {
+    try
+    {
+     ret = CDAFR_DecodeAhead_Open(ret);
+    }
+    catch(...)
+    {
+     delete ret;
+     throw;
+    }
+   }
+
+   return ret;
   }
   catch(int i)
   {
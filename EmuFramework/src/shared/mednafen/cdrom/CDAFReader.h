@@ -34,6 +34,13 @@ class CDAFReader
  virtual ~CDAFReader();
 
  virtual uint64 FrameCount(void) = 0;
+
+ // Position likely to be seeked to later(e.g. a track start), must be called before the first Read()
+ virtual void AddSeekHint(uint64 frame_offset) { }
+
+ // Reads have moved to another reader, so resources that the next Read() can recreate may be freed
+ virtual void Release(void) { }
+
  INLINE uint64 Read(uint64 frame_offset, int16 *buffer, uint64 frames)
  {
   uint64 ret;
@@ -63,7 +70,8 @@ class CDAFReader
 
 // AR_Open(), and CDAFReader, will NOT take "ownership" of the Stream object(IE it won't ever delete it).  Though it does assume it has exclusive access
 // to it for as long as the CDAFReader object exists.
-CDAFReader *CDAFR_Open(Stream *fp);
+// If "decode_ahead" is true, compressed formats are decoded on a separate thread ahead of the read position.
+CDAFReader *CDAFR_Open(Stream *fp, bool decode_ahead = false);
 
 }
 #endif
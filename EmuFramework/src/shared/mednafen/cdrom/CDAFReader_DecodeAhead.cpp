@@ -0,0 +1,400 @@
+/******************************************************************************/
+/* Mednafen - Multi-system Emulator                                           */
+/******************************************************************************/
+/* CDAFReader_DecodeAhead.cpp:
+**
+** This program is free software; you can redistribute it and/or
+** modify it under the terms of the GNU General Public License
+** as published by the Free Software Foundation; either version 2
+** of the License, or (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software Foundation, Inc.,
+** 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+//
+// Wraps a compressed-audio CDAFReader, decoding it on a worker thread into a ring of PCM frames ahead of the
+// last read position, so reads on the emulation thread are usually just a copy.  Seeks within the ring(including
+// a short history behind the read position) don't restart decoding.  When the ring is full, the worker also
+// pre-decodes the start of each track(hinted from the TOC via AddSeekHint()), so jumping to a track doesn't stall
+// on the decoder either.
+//
+// The worker thread and buffers are only created on the first read, since cue sheets with one file per track
+// can open dozens of these.  They're released again when reads move to another reader(see Release()), or when
+// nothing has been read for IdleTimeoutMS, and recreated by the next read.
+//
+
+#include <mednafen/mednafen.h>
+#include <mednafen/MThreading.h>
+#include "CDAFReader.h"
+#include "CDAFReader_DecodeAhead.h"
+
+namespace Mednafen
+{
+
+class CDAFReader_DecodeAhead final : public CDAFReader
+{
+ public:
+ CDAFReader_DecodeAhead(CDAFReader* inner_reader);
+ ~CDAFReader_DecodeAhead();
+
+ uint64 Read_(int16 *buffer, uint64 frames) override;
+ bool Seek_(uint64 frame_offset) override;
+ uint64 FrameCount(void) override;
+ void AddSeekHint(uint64 frame_offset) override;
+ void Release(void) override;
+
+ private:
+
+ enum : uint64
+ {
+  ChunkFrames = 588,			// one sector
+  RingFrames = ChunkFrames * 96,
+  HistoryFrames = ChunkFrames * 8,	// kept behind the read position for short backwards seeks
+  HintFrames = ChunkFrames * 16
+ };
+
+ enum : unsigned { IdleTimeoutMS = 5000 };
+
+ struct SeekHint
+ {
+  uint64 pos;
+  uint64 frames = 0;
+  bool ready = false;
+  std::unique_ptr<int16[]> data;
+ };
+
+ static int WorkerEntry(void* data);
+ void WorkerMain(void);
+ void StartWorker(uint64 frame_offset);
+ void StopWorker(void);
+ void Restart(uint64 frame_offset);
+ void CopyToRing(uint64 pos, const int16* src, uint64 frames);
+ bool NeedDecode(void) const { return !decode_eof && (decode_pos + ChunkFrames + HistoryFrames) <= (read_pos + RingFrames); }
+
+ std::unique_ptr<CDAFReader> inner;
+ uint64 frame_count;
+ std::vector<SeekHint> hints;
+
+ MThreading::Thread* thread = nullptr;
+ MThreading::Mutex* mutex = nullptr;
+ MThreading::Cond* work_cond = nullptr;
+ MThreading::Cond* data_cond = nullptr;
+
+ //
+ // Protected by mutex once the worker is running
+ //
+ std::unique_ptr<int16[]> ring;
+ uint64 valid_start = 0;	// frames [valid_start, decode_pos) are in the ring
+ uint64 decode_pos = 0;
+ uint64 read_pos = 0;
+ uint32 generation = 0;		// incremented when the ring is restarted, so the worker discards the chunk it's decoding
+ bool decode_eof = false;
+ std::exception_ptr decode_error;	// rethrown by Read_() once it reaches decode_pos
+ uint32 activity = 0;		// incremented by Seek_() and Read_(), so the worker can tell when it's been idle
+ bool worker_idle = false;	// set when the worker has freed the ring and exited on its own
+ bool exiting = false;
+};
+
+CDAFReader_DecodeAhead::CDAFReader_DecodeAhead(CDAFReader* inner_reader) : inner(inner_reader)
+{
+ frame_count = inner->FrameCount();
+}
+
+CDAFReader_DecodeAhead::~CDAFReader_DecodeAhead()
+{
+ if(thread)
+  StopWorker();
+
+ if(data_cond)
+  MThreading::Cond_Destroy(data_cond);
+
+ if(work_cond)
+  MThreading::Cond_Destroy(work_cond);
+
+ if(mutex)
+  MThreading::Mutex_Destroy(mutex);
+}
+
+uint64 CDAFReader_DecodeAhead::FrameCount(void)
+{
+ return frame_count;
+}
+
+void CDAFReader_DecodeAhead::AddSeekHint(uint64 frame_offset)
+{
+ assert(!thread);
+
+ if(frame_offset >= frame_count)
+  return;
+
+ for(auto const& h : hints)
+ {
+  if(h.pos == frame_offset)
+   return;
+ }
+
+ hints.push_back({ frame_offset });
+}
+
+void CDAFReader_DecodeAhead::Release(void)
+{
+ if(thread)
+  StopWorker();
+}
+
+void CDAFReader_DecodeAhead::StartWorker(uint64 frame_offset)
+{
+ ring.reset(new int16[RingFrames * 2]);
+
+ if(!mutex)
+ {
+  mutex = MThreading::Mutex_Create();
+  work_cond = MThreading::Cond_Create();
+  data_cond = MThreading::Cond_Create();
+ }
+
+ read_pos = frame_offset;
+ Restart(frame_offset);
+ thread = MThreading::Thread_Create(WorkerEntry, this, "CDAFReader_DecodeAhead");
+}
+
+//
+// Hints are kept, so a restarted worker doesn't decode them again.
+//
+void CDAFReader_DecodeAhead::StopWorker(void)
+{
+ MThreading::Mutex_Lock(mutex);
+ exiting = true;
+ MThreading::Cond_Signal(work_cond);
+ MThreading::Mutex_Unlock(mutex);
+
+ MThreading::Thread_Wait(thread, nullptr);
+ thread = nullptr;
+ exiting = false;
+ worker_idle = false;
+ ring.reset();
+}
+
+//
+// Called with the mutex locked, or before the worker is created.
+//
+void CDAFReader_DecodeAhead::Restart(uint64 frame_offset)
+{
+ generation++;
+ valid_start = decode_pos = frame_offset;
+ decode_eof = false;
+ decode_error = nullptr;
+
+ for(auto const& h : hints)
+ {
+  if(h.ready && frame_offset >= h.pos && frame_offset < (h.pos + h.frames))
+  {
+   CopyToRing(h.pos, h.data.get(), h.frames);
+   valid_start = h.pos;
+   decode_pos = h.pos + h.frames;
+   decode_eof = h.frames < HintFrames;
+   break;
+  }
+ }
+}
+
+int CDAFReader_DecodeAhead::WorkerEntry(void* data)
+{
+ ((CDAFReader_DecodeAhead*)data)->WorkerMain();
+ return 0;
+}
+
+void CDAFReader_DecodeAhead::CopyToRing(uint64 pos, const int16* src, uint64 frames)
+{
+ while(frames)
+ {
+  const uint64 ring_pos = pos % RingFrames;
+  const uint64 count = std::min<uint64>(frames, RingFrames - ring_pos);
+
+  memcpy(&ring[ring_pos * 2], src, count * 2 * sizeof(int16));
+  pos += count;
+  src += count * 2;
+  frames -= count;
+ }
+}
+
+//
+// The inner reader is only ever used from the worker thread once it's running.
+//
+void CDAFReader_DecodeAhead::WorkerMain(void)
+{
+ int16 chunk[ChunkFrames * 2];
+
+ auto decode = [&](uint64 pos, int16* dest, uint64 frames, std::exception_ptr* error) -> uint64
+ {
+  try
+  {
+   return inner->Read(pos, dest, frames);
+  }
+  catch(std::exception& e)
+  {
+   MDFN_Notify(MDFN_NOTICE_WARNING, "Error decoding CD audio at frame %llu: %s", (unsigned long long)pos, e.what());
+   if(error)
+    *error = std::current_exception();
+   return 0;
+  }
+ };
+
+ MThreading::Mutex_Lock(mutex);
+ while(!exiting)
+ {
+  if(NeedDecode())
+  {
+   const uint64 pos = decode_pos;
+   const uint32 gen = generation;
+   std::exception_ptr error;
+
+   MThreading::Mutex_Unlock(mutex);
+   const uint64 frames_read = decode(pos, chunk, ChunkFrames, &error);
+   MThreading::Mutex_Lock(mutex);
+
+   if(gen == generation)
+   {
+    CopyToRing(pos, chunk, frames_read);
+    decode_pos += frames_read;
+    valid_start = std::max<uint64>(valid_start, (decode_pos > RingFrames) ? decode_pos - RingFrames : 0);
+
+    if(frames_read < ChunkFrames)
+     decode_eof = true;
+
+    decode_error = error;
+
+    MThreading::Cond_Signal(data_cond);
+   }
+   continue;
+  }
+
+  SeekHint* h = nullptr;
+  for(auto& hint : hints)
+  {
+   if(!hint.ready)
+   {
+    h = &hint;
+    break;
+   }
+  }
+
+  if(h)
+  {
+   MThreading::Mutex_Unlock(mutex);
+   std::unique_ptr<int16[]> data(new int16[HintFrames * 2]);
+   // A failed hint is just left empty, the error is reported again if playback reaches it.
+   const uint64 frames_read = decode(h->pos, data.get(), HintFrames, nullptr);
+   MThreading::Mutex_Lock(mutex);
+
+   h->data = std::move(data);
+   h->frames = frames_read;
+   h->ready = true;
+   continue;
+  }
+
+  const uint32 last_activity = activity;
+
+  if(!MThreading::Cond_TimedWait(work_cond, mutex, IdleTimeoutMS) && last_activity == activity && !exiting)
+  {
+   // Nothing has been read for a while(e.g. the game paused the CD), so don't hold onto the ring.
+   ring.reset();
+   worker_idle = true;
+   break;
+  }
+ }
+ MThreading::Mutex_Unlock(mutex);
+}
+
+bool CDAFReader_DecodeAhead::Seek_(uint64 frame_offset)
+{
+ if(thread)
+ {
+  MThreading::Mutex_Lock(mutex);
+  if(!worker_idle)
+  {
+   if(frame_offset < valid_start || frame_offset > decode_pos)
+    Restart(frame_offset);
+
+   read_pos = frame_offset;
+   activity++;
+   MThreading::Cond_Signal(work_cond);
+   MThreading::Mutex_Unlock(mutex);
+
+   return true;
+  }
+  MThreading::Mutex_Unlock(mutex);
+  StopWorker();
+ }
+
+ StartWorker(frame_offset);
+ return true;
+}
+
+uint64 CDAFReader_DecodeAhead::Read_(int16* buffer, uint64 frames)
+{
+ uint64 ret = 0;
+
+ if(!thread)
+  Seek_(read_pos);
+
+ MThreading::Mutex_Lock(mutex);
+ if(worker_idle)
+ {
+  // Continuing from where the idle worker stopped.
+  MThreading::Mutex_Unlock(mutex);
+  Seek_(read_pos);
+  MThreading::Mutex_Lock(mutex);
+ }
+ activity++;
+
+ while(ret < frames)
+ {
+  const uint64 avail = decode_pos - read_pos;
+
+  if(!avail)
+  {
+   if(decode_eof)
+   {
+    if(decode_error && !ret)
+    {
+     // Rethrown on this thread so the caller sees the same error as with the unwrapped reader.
+     std::exception_ptr error = std::move(decode_error);
+
+     MThreading::Mutex_Unlock(mutex);
+     std::rethrow_exception(error);
+    }
+    break;
+   }
+
+   MThreading::Cond_Signal(work_cond);
+   MThreading::Cond_Wait(data_cond, mutex);
+   continue;
+  }
+
+  const uint64 ring_pos = read_pos % RingFrames;
+  const uint64 count = std::min<uint64>({ avail, frames - ret, RingFrames - ring_pos });
+
+  memcpy(&buffer[ret * 2], &ring[ring_pos * 2], count * 2 * sizeof(int16));
+  read_pos += count;
+  ret += count;
+ }
+ MThreading::Cond_Signal(work_cond);
+ MThreading::Mutex_Unlock(mutex);
+
+ return ret;
+}
+
+CDAFReader* CDAFR_DecodeAhead_Open(CDAFReader* inner)
+{
+ return new CDAFReader_DecodeAhead(inner);
+}
+
+}
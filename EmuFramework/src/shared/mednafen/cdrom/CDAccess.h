@@ -48,6 +48,13 @@ class CDAccess
 
  virtual int Read_Sector(uint8 *buf, int32 lba, uint32 size) = 0;
 
+ // Copies "size" bytes of sector data out of "raw", as read by Read_Raw_Sector(), at the offset for the "format" it returned
+ static void CopySectorData(uint8 *buf, const uint8 *raw, int format, uint32 size);
+
+ // Loads the image data into memory after opening it without image_memcache, so the TOC can be checked
+ // first without reopening the image.  Audio track files read through a CDAFReader are left as they are.
+ virtual void Memcache(void) = 0;
+
  private:
  CDAccess(const CDAccess&);	// No copy constructor.
  CDAccess& operator=(const CDAccess&); // No assignment operator.
@@ -70,6 +70,8 @@ class CDAccess_CHD final : public CDAccess
 
  int Read_Sector(uint8 *buf, int32 lba, uint32 size) final;
 
+ void Memcache(void) final;
+
  private:
 
  void Load(VirtualFS* vfs, const std::string& path, bool image_memcache);
@@ -667,7 +667,7 @@ void CDAccess_Image::ImageOpen(VirtualFS* vfs, const std::string& path, bool ima
      {
       try
       {
-       if(!(TmpTrack.AReader = CDAFR_Open(TmpTrack.fp)))
+       if(!(TmpTrack.AReader = CDAFR_Open(TmpTrack.fp, true)))
         throw MDFN_Error(0, _("Unsupported audio track file format."));
       }
       catch(std::exception& e)
@@ -900,6 +900,10 @@ void CDAccess_Image::ImageOpen(VirtualFS* vfs, const std::string& path, bool ima
    //printf("%d, %ld %d %d %d %d\n", x, FileOffset, Tracks[x].index, Tracks[x].pregap, Tracks[x].sectors, Tracks[x].LBA);
 
    FileOffset += Tracks[x].sectors * DI_Size_Table[Tracks[x].DIFormat];
+
+   // Let a decode-ahead reader pre-decode the start of the track.
+   if(Tracks[x].AReader)
+    Tracks[x].AReader->AddSeekHint(Tracks[x].FileOffset / 4);
   } // end to cue sheet handling
  } // end to track loop
 
@@ -947,6 +951,8 @@ void CDAccess_Image::ImageOpen(VirtualFS* vfs, const std::string& path, bool ima
 
 void CDAccess_Image::Cleanup(void)
 {
+ LastAReader = nullptr;
+
  for(int32 track = 0; track < 100; track++)
  {
   CDRFILE_TRACK_INFO *this_track = &Tracks[track];
@@ -1079,6 +1085,14 @@ int CDAccess_Image::Read_Raw_Sector(uint8 *buf, int32 lba)
    if(ct->AReader)
    {
     int16 AudioBuf[588 * 2];
+
+    if(ct->AReader != LastAReader)
+    {
+     if(LastAReader)
+      LastAReader->Release();
+     LastAReader = ct->AReader;
+    }
+
     uint64 frames_read = ct->AReader->Read((ct->FileOffset / 4) + (lba - ct->LBA) * 588, AudioBuf, 588);
 
     ct->LastSamplePos += frames_read;
@@ -79,6 +79,8 @@ class CDAccess_Image final: public CDAccess
 
  int Read_Sector(uint8 *buf, int32 lba, uint32 size) final;
 
+ void Memcache(void) final;
+
  private:
 
  int32 NumTracks{};
@@ -88,6 +90,7 @@ class CDAccess_Image final: public CDAccess
  uint8 disc_type;
  CDRFILE_TRACK_INFO Tracks[100]{}; // Track #0(HMM?) through 99
  CDUtility::TOC toc{};
+ CDAFReader* LastAReader{};	// released when reads move to another track's reader
 
  std::map<uint32, std::array<uint8, 12>> SubQReplaceMap;
 
@@ -47,6 +47,11 @@ bool CDInterface::NonDeterministic_CheckSectorReady(int32 lba)
  return true;
 }
 
+CDInterface::ReadStats CDInterface::GetReadStats(void)
+{
+ return ReadStats();
+}
+
 uint8 CDInterface::ReadSectors(uint8* buf, int32 lba, uint32 sector_count)
 {
  uint8 ret = 0;
@@ -43,6 +43,15 @@ class CDInterface
  //
  static CDInterface* Open(VirtualFS* vfs, const std::string& path, bool image_memcache, const uint64 affinity);
 
+ //
+ // Like Open(), but "image_memcache" is only used if the disc's raw size is at most "memcache_budget"
+ // bytes(0 to never use it, ~0 to always use it), otherwise sectors are read on a thread that prefetches
+ // ahead along the current track.  The size of a cached image is subtracted from "memcache_budget", so
+ // one budget can be passed for every disc in a set.  Images loaded through a VirtualFS other than NVFS
+ // are always memory cached.
+ //
+ static CDInterface* OpenWithMemcacheLimit(VirtualFS* vfs, const std::string& path, uint64& memcache_budget, const uint64 affinity);
+
  CDInterface();
  virtual ~CDInterface();
 
@@ -68,6 +77,13 @@ class CDInterface
  //
  virtual bool ReadRawSector(uint8* buf, int32 lba) = 0;
 
+ //
+ // Reads "size" bytes of sector data, skipping the header according to the track's image format
+ // like CDAccess::Read_Sector().  Data stored without headers(e.g. ISO) is read without building
+ // the raw sector when the image is read on the calling thread.
+ //
+ virtual bool ReadSector(uint8* buf, int32 lba, uint32 size) = 0;
+
  //
  // Reads 96 bytes of raw subchannel PW data into pwbuf.  Will be relatively
  // fast and nonblocking, unless the underlying CD (image) access method does
@@ -81,6 +97,20 @@ class CDInterface
  // For experimental and special use cases.
  virtual bool NonDeterministic_CheckSectorReady(int32 lba);
 
+ //
+ // Counts of ReadRawSector() calls, and of those that had to wait for sector data to be read from the
+ // image(always 0 for memory cached images).
+ //
+ struct ReadStats
+ {
+  uint64 reads = 0;
+  uint64 stalls = 0;
+  uint64 stall_time_us = 0;
+  uint64 max_stall_time_us = 0;
+ };
+
+ virtual ReadStats GetReadStats(void);
+
  INLINE void ReadTOC(CDUtility::TOC* read_target)
  {
   *read_target = disc_toc;
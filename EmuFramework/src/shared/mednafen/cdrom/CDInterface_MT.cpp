@@ -21,6 +21,7 @@
 
 #include <mednafen/mednafen.h>
 #include "CDInterface_MT.h"
+#include <chrono>
 
 namespace Mednafen
 {
@@ -128,6 +129,7 @@ int CDInterface_MT::ReadThreadStart()
  ra_lba = 0;
  ra_count = 0;
  last_read_lba = LBA_Read_Maximum + 1;
+ idle_ra_end = 0;
 
  try
  {
@@ -142,6 +144,7 @@ int CDInterface_MT::ReadThreadStart()
   ra_lba = 0;
   ra_count = 0;
   last_read_lba = LBA_Read_Maximum + 1;
+  idle_ra_end = 0;
   memset(SectorBuffers, 0, SBSize * sizeof(CDInterface_Sector_Buffer));
  }
  catch(std::exception &e)
@@ -159,7 +162,7 @@ int CDInterface_MT::ReadThreadStart()
   //printf("%d %d %d\n", last_read_lba, ra_lba, ra_count);
 
   // Only do a blocking-wait for a message if we don't have any sectors to read-ahead.
-  if(ReadThreadQueue.Read(&msg, ra_count ? false : true))
+  if(ReadThreadQueue.Read(&msg, (ra_count || ra_lba < idle_ra_end) ? false : true))
   {
    if(msg.message == CDInterface_MSG_DIEDIEDIE)
     Running = false;
@@ -189,9 +192,28 @@ int CDInterface_MT::ReadThreadStart()
     }
 
     last_read_lba = new_lba;
+
+    //
+    // While idle, keep reading ahead along the current track, so sequential reads(and CD-DA playback) don't
+    // have to wait on slow storage.
+    //
+    static const int max_idle_ra = 48;
+    static_assert((unsigned int)max_idle_ra < (SBSize / 4), "Max idle readahead too large.");
+    const int track = (new_lba >= 0) ? disc_toc.FindTrackByLBA(new_lba) : 0;
+
+    idle_ra_end = 0;
+    if(track)
+    {
+     const int32 track_end = (track < disc_toc.last_track) ? disc_toc.tracks[track + 1].lba : disc_toc.tracks[100].lba;
+
+     idle_ra_end = std::min<int32>(new_lba + 1 + max_idle_ra, track_end);
+    }
    }
   }
 
+  if(!ra_count && ra_lba > last_read_lba && ra_lba < idle_ra_end)
+   ra_count = 1;
+
   //
   // Don't read beyond what the disc (image) readers can handle sanely.
   //
@@ -205,10 +227,11 @@ int CDInterface_MT::ReadThreadStart()
   {
    uint8 tmpbuf[2352 + 96];
    bool error_condition = false;
+   int format = -1;
 
    try
    {
-    disc_cdaccess->Read_Raw_Sector(tmpbuf, ra_lba);
+    format = disc_cdaccess->Read_Raw_Sector(tmpbuf, ra_lba);
    }
    catch(std::exception &e)
    {
@@ -225,6 +248,7 @@ int CDInterface_MT::ReadThreadStart()
    memcpy(SectorBuffers[SBWritePos].data, tmpbuf, 2352 + 96);
    SectorBuffers[SBWritePos].valid = true;
    SectorBuffers[SBWritePos].error = error_condition;
+   SectorBuffers[SBWritePos].format = format;
    SBWritePos = (SBWritePos + 1) % SBSize;
 
    MThreading::Cond_Signal(SBCond);
@@ -306,8 +330,7 @@ CDInterface_MT::~CDInterface_MT()
 
 bool CDInterface_MT::ReadRawSector(uint8 *buf, int32 lba)
 {
- bool found = false;
- bool error_condition = false;
+ int format;
 
  if(UnrecoverableError)
  {
@@ -321,6 +344,41 @@ bool CDInterface_MT::ReadRawSector(uint8 *buf, int32 lba)
   memset(buf, 0, 2352 + 96);
   return false;
  }
+
+ return ReadBufferedSector(buf, lba, format);
+}
+
+//
+// The image is only read on the read thread, so the raw sector is always built there and the data copied out of it.
+//
+bool CDInterface_MT::ReadSector(uint8* buf, int32 lba, uint32 size)
+{
+ uint8 tmpbuf[2352 + 96];
+ int format;
+
+ if(UnrecoverableError)
+ {
+  memset(buf, 0, size);
+  return false;
+ }
+
+ if(lba < LBA_Read_Minimum || lba > LBA_Read_Maximum)
+ {
+  printf("Attempt to read sector out of bounds; LBA=%d\n", lba);
+  memset(buf, 0, size);
+  return false;
+ }
+
+ const bool ret = ReadBufferedSector(tmpbuf, lba, format);
+ CDAccess::CopySectorData(buf, tmpbuf, format, size);
+
+ return ret;
+}
+
+bool CDInterface_MT::ReadBufferedSector(uint8 *buf, int32 lba, int& format)
+{
+ bool found = false;
+ bool error_condition = false;
  //fprintf(stderr, "%d\n", ra_lba - lba);
 
  ReadThreadQueue.Write(CDInterface_Message(CDInterface_MSG_READ_SECTOR, lba));
@@ -328,8 +386,12 @@ bool CDInterface_MT::ReadRawSector(uint8 *buf, int32 lba)
  //
  //
  //
+ std::chrono::steady_clock::time_point stall_start;
+
  MThreading::Mutex_Lock(SBMutex);
 
+ read_stats.reads++;
+
  do
  {
   for(int i = 0; i < SBSize; i++)
@@ -337,6 +399,7 @@ bool CDInterface_MT::ReadRawSector(uint8 *buf, int32 lba)
    if(SectorBuffers[i].valid && SectorBuffers[i].lba == lba)
    {
     error_condition = SectorBuffers[i].error;
+    format = SectorBuffers[i].format;
     memcpy(buf, SectorBuffers[i].data, 2352 + 96);
     found = true;
    }
@@ -344,12 +407,23 @@ bool CDInterface_MT::ReadRawSector(uint8 *buf, int32 lba)
 
   if(!found)
   {
+   if(stall_start == std::chrono::steady_clock::time_point())
+    stall_start = std::chrono::steady_clock::now();
    //int32 swt = MDFND_GetTime();
    MThreading::Cond_Wait(SBCond, SBMutex);
    //printf("SB Waited: %d\n", MDFND_GetTime() - swt);
   }
  } while(!found);
 
+ if(stall_start != std::chrono::steady_clock::time_point())
+ {
+  const uint64 stall_time_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - stall_start).count();
+
+  read_stats.stalls++;
+  read_stats.stall_time_us += stall_time_us;
+  read_stats.max_stall_time_us = std::max<uint64>(read_stats.max_stall_time_us, stall_time_us);
+ }
+
  MThreading::Mutex_Unlock(SBMutex);
  //
  //
@@ -399,4 +473,15 @@ void CDInterface_MT::HintReadSector(int32 lba)
  ReadThreadQueue.Write(CDInterface_Message(CDInterface_MSG_READ_SECTOR, lba));
 }
 
+CDInterface::ReadStats CDInterface_MT::GetReadStats(void)
+{
+ ReadStats ret;
+
+ MThreading::Mutex_Lock(SBMutex);
+ ret = read_stats;
+ MThreading::Mutex_Unlock(SBMutex);
+
+ return ret;
+}
+
 }
@@ -40,7 +40,9 @@ class CDInterface_MT : public CDInterface
 
  virtual void HintReadSector(int32 lba) override;
  virtual bool ReadRawSector(uint8 *buf, int32 lba) override;
+ virtual bool ReadSector(uint8* buf, int32 lba, uint32 size) override;
  virtual bool ReadRawSectorPWOnly(uint8* pwbuf, int32 lba, bool hint_fullread) override;
+ virtual ReadStats GetReadStats(void) override;
 
  // FIXME: Semi-private:
  int ReadThreadStart(void);
@@ -48,6 +50,7 @@ class CDInterface_MT : public CDInterface
  private:
 
  void Cleanup(void) MDFN_COLD;
+ bool ReadBufferedSector(uint8 *buf, int32 lba, int& format);
 
  std::unique_ptr<CDAccess> disc_cdaccess;
 
@@ -114,6 +117,7 @@ class CDInterface_MT : public CDInterface
   bool valid;
   bool error;
   int32 lba;
+  int format;	// returned by CDAccess::Read_Raw_Sector()
   uint8 data[2352 + 96];
  } SectorBuffers[SBSize];
 
@@ -122,12 +126,15 @@ class CDInterface_MT : public CDInterface
  MThreading::Mutex* SBMutex;
  MThreading::Cond* SBCond;
 
+ ReadStats read_stats;	// Protected by SBMutex
+
  //
  // Read-thread-only:
  //
  int32 ra_lba;
  int32 ra_count;
  int32 last_read_lba;
+ int32 idle_ra_end;
 };
 
 }
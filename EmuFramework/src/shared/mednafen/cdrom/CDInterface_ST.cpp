@@ -82,6 +82,35 @@ bool CDInterface_ST::ReadRawSector(uint8 *buf, int32 lba)
  return true;
 }
 
+bool CDInterface_ST::ReadSector(uint8 *buf, int32 lba, uint32 size)
+{
+ if(UnrecoverableError)
+ {
+  memset(buf, 0, size);
+  return false;
+ }
+
+ if(lba < LBA_Read_Minimum || lba > LBA_Read_Maximum)
+ {
+  MDFN_printf("Attempt to read sector out of bounds; LBA=%d\n", lba);
+  memset(buf, 0, size);
+  return false;
+ }
+
+ try
+ {
+  disc_cdaccess->Read_Sector(buf, lba, size);
+ }
+ catch(std::exception &e)
+ {
+  MDFN_Notify(MDFN_NOTICE_ERROR, _("Sector %u read error: %s"), lba, e.what());
+  memset(buf, 0, size);
+  return false;
+ }
+
+ return true;
+}
+
 bool CDInterface_ST::ReadRawSectorPWOnly(uint8* pwbuf, int32 lba, bool hint_fullread)
 {
  if(UnrecoverableError)
@@ -38,6 +38,7 @@ class CDInterface_ST : public CDInterface
 
  virtual void HintReadSector(int32 lba) override;
  virtual bool ReadRawSector(uint8* buf, int32 lba) override;
+ virtual bool ReadSector(uint8* buf, int32 lba, uint32 size) override;
  virtual bool ReadRawSectorPWOnly(uint8* pwbuf, int32 lba, bool hint_fullread) override;
 
  private:
@@ -93,7 +93,8 @@ static void updateTexture(const EmuApp &app, VControllerElement &e, Gfx::Rendere
 						case incStateSlot: return app.asset(AssetID::rightSwitch);
 						case fastForward:
 						case toggleFastForward: return app.asset(AssetID::fast);
-						case takeScreenshot: return app.asset(AssetID::screenshot);
+						case takeScreenshot:
+						case takeScreenshotBurst: return app.asset(AssetID::screenshot);
 						case openSystemActions: return app.asset(AssetID::menu);
 						case turboModifier: return app.asset(AssetID::speed);
 						case exitApp: return app.asset(AssetID::close);
@@ -72,6 +72,7 @@ extern struct CoreOptions {
     static constexpr int layerSettings = 0xff00;
     static constexpr int rtcEnabled = 1;
     int saveType = 0;
+    bool skipIdleLoops = false;
     static constexpr int skipSaveGameBattery = 0;
     static constexpr int skipSaveGameCheats = 0;
     int useBios = 0;
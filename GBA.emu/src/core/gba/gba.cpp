@@ -3882,7 +3882,7 @@ void CPULoop(GBASys &gba, EmuEx::EmuSystemTaskContext taskCtx, EmuEx::EmuVideo *
 
               uint32_t ext = (joy >> 10);
               // If no (m) code is enabled, apply the cheats at each LCDline
-              if (cheatsList.size())
+              if (cheatsNeedApply())
               	remainingTicks += cheatsCheckKeys(cpu, P1 ^ 0x3FF, 0);
 
 #if 0
@@ -1,5 +1,6 @@
 #include "core/gba/gbaCheats.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 
@@ -194,6 +195,7 @@ std::vector<CheatsData> cheatsList;
 uint32_t rompatch2addr[4];
 uint16_t rompatch2val[4];
 uint16_t rompatch2oldval[4];
+static bool cheatsHaveEnabled = false;
 
 uint8_t cheatsCBASeedBuffer[0x30];
 uint32_t cheatsCBASeed[4];
@@ -574,6 +576,18 @@ static int getCodeLength(int num)
   return 1;
 }
 
+void cheatsUpdateEnabledState()
+{
+  cheatsHaveEnabled = std::ranges::any_of(cheatsList, &CheatsData::enabled);
+}
+
+// True if cheatsCheckKeys() has any work to do, either applying enabled codes
+// or restoring ROM patches left over from codes that were just disabled
+bool cheatsNeedApply()
+{
+  return cheatsHaveEnabled || std::ranges::any_of(rompatch2addr, [](uint32_t addr) { return addr != 0; });
+}
+
 int cheatsCheckKeys(ARM7TDMI &cpu, uint32_t keys, uint32_t extended)
 {
   bool onoff = true;
@@ -1331,6 +1345,7 @@ void cheatsAdd(ARM7TDMI &cpu, const char *codeStr,
       cheatsList[x].oldValue = CPUReadMemory(address);
       break;
     }
+    cheatsHaveEnabled = true;
   }
 }
 
@@ -1385,6 +1400,7 @@ void cheatsDelete(ARM7TDMI &cpu, int number, bool restore)
       }
     }
     cheatsList.erase(cheatsList.begin() + number);
+    cheatsUpdateEnabledState();
   }
 }
 
@@ -1398,6 +1414,7 @@ void cheatsDeleteAll(ARM7TDMI &cpu, bool restore)
 void cheatsEnable(CheatsData& c) {
 	c.enabled = true;
 	mastercode = 0;
+	cheatsHaveEnabled = true;
 }
 
 void cheatsEnable(int i)
@@ -1429,6 +1446,7 @@ void cheatsDisable(ARM7TDMI& cpu, CheatsData& c) {
 		break;
 	}
 	c.enabled = false;
+	cheatsUpdateEnabledState();
 }
 
 void cheatsDisable(ARM7TDMI &cpu, int i)
@@ -2673,6 +2691,7 @@ void cheatsReadGame(gzFile file, int version)
       }
     }
   }
+  cheatsUpdateEnabledState();
 }
 
 // skip the cheat list data
@@ -2820,6 +2839,7 @@ bool cheatsLoadCheatList(IG::ApplicationContext ctx, const char *file)
     }
   }
   fclose(f);
+  cheatsUpdateEnabledState();
   return true;
 }
 #endif
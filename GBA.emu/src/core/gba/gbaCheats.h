@@ -54,6 +54,8 @@ void cheatsWriteHalfWord(uint32_t address, uint16_t value);
 void cheatsWriteByte(uint32_t address, uint8_t value);
 #endif
 int cheatsCheckKeys(ARM7TDMI &cpu, uint32_t keys, uint32_t extended);
+void cheatsUpdateEnabledState();
+bool cheatsNeedApply();
 
 extern std::vector<CheatsData> cheatsList;
 
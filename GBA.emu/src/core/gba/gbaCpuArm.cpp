@@ -2850,6 +2850,7 @@ int armExecute(ARM7TDMI &cpu)
 {
 	int &cpuNextEvent = cpu.cpuNextEvent;
 	int &cpuTotalTicks = cpu.cpuTotalTicks;
+	ARM7TDMI::IdleLoopSnapshot idleLoop;
     do {
 		if (coreOptions.cheatsEnabled) {
 			cpuMasterCodeCheck(cpu);
@@ -2996,6 +2997,11 @@ int armExecute(ARM7TDMI &cpu)
             clockTicks = 1 + codeTicksAccessSeq32(oldArmNextPC);
         cpuTotalTicks += clockTicks;
 
+        if (UNLIKELY(armNextPC <= (uint32_t)oldArmNextPC) && coreOptions.skipIdleLoops &&
+            (uint32_t)oldArmNextPC - armNextPC <= ARM7TDMI::IdleLoopSnapshot::maxLoopBytes &&
+            cpu.isIdleLoop(idleLoop, armNextPC) && cpuTotalTicks < cpuNextEvent)
+            cpuTotalTicks = cpuNextEvent;
+
     } while (cpuTotalTicks < cpuNextEvent &&
     		(!CONFIG_TRIGGER_ARM_STATE_EVENT && armState) && !cpu.SWITicks);
     return 1;
@@ -1521,6 +1521,7 @@ static INSN_REGPARM int thumb98(ARM7TDMI &cpu, uint32_t opcode, uint32_t oldArmN
   if (busPrefetchCount == 0)
     busPrefetch = busPrefetchEnable;
   uint32_t address = reg[13].I + ((opcode & 255) << 2);
+  checkIdleLoopRead(cpu, address);
   reg[regist].I = CPUReadMemoryQuick(cpu, address);
   return 3 + dataTicksAccess32(address) + codeTicksAccess16(armNextPC);
 }
@@ -2098,6 +2099,7 @@ int thumbExecute(ARM7TDMI &cpu)
 {
 	int &cpuNextEvent = cpu.cpuNextEvent;
 	int &cpuTotalTicks = cpu.cpuTotalTicks;
+	ARM7TDMI::IdleLoopSnapshot idleLoop;
   do {
 	  if (coreOptions.cheatsEnabled) {
 		  cpuMasterCodeCheck(cpu);
@@ -2179,6 +2181,11 @@ int thumbExecute(ARM7TDMI &cpu)
         clockTicks = codeTicksAccessSeq16(oldArmNextPC) + 1;
     cpuTotalTicks += clockTicks;
 
+    if (UNLIKELY(armNextPC <= oldArmNextPC) && coreOptions.skipIdleLoops &&
+        oldArmNextPC - armNextPC <= ARM7TDMI::IdleLoopSnapshot::maxLoopBytes &&
+        cpu.isIdleLoop(idleLoop, armNextPC) && cpuTotalTicks < cpuNextEvent)
+        cpuTotalTicks = cpuNextEvent;
+
   } while (cpuTotalTicks < cpuNextEvent &&
   		(!CONFIG_TRIGGER_ARM_STATE_EVENT && !armState) && !cpu.SWITicks);
   return 1;
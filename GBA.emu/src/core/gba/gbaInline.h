@@ -94,9 +94,39 @@ static inline int8_t Downcast8(T value) {
     return static_cast<int8_t>(value);
 }
 
+// Only loads from RAM, ROM and the I/O registers the scheduler updates (DISPSTAT/VCOUNT
+// per scanline, KEYINPUT per frame, IE/IF/IME on interrupts) return the same value until
+// the next event. Other I/O (timer counters depend on cpuTotalTicks), save chips and the
+// RTC can change in between, so loops reading them are never treated as idle.
+static inline void checkIdleLoopRead(ARM7TDMI &cpu, uint32_t address)
+{
+    if (LIKELY(!coreOptions.skipIdleLoops))
+        return;
+    const uint32_t region = address >> 24;
+    const bool isRam = region == 2 || region == 3;
+    const bool isRom = region >= 8 && region <= 12 && (address & ~0xfu) != 0x80000c0;
+    if (isRam || isRom)
+        return;
+    switch (address & ~3u) {
+    case 0x4000004: // DISPSTAT, VCOUNT
+    case 0x4000130: // KEYINPUT, KEYCNT
+    case 0x4000200: // IE, IF
+    case 0x4000208: // IME
+        return;
+    }
+    cpu.volatileRead = true;
+}
+
+static inline void checkIdleLoopWrite(ARM7TDMI &cpu)
+{
+    if (UNLIKELY(coreOptions.skipIdleLoops))
+        cpu.memWritten = true;
+}
+
 static inline uint32_t CPUReadMemory(ARM7TDMI &cpu, uint32_t address)
 {
     auto &g_ioMem = cpu.gba->mem.ioMem.b;
+    checkIdleLoopRead(cpu, address);
 #ifdef VBAM_ENABLE_DEBUGGER
     memoryMap* m = &map[address >> 24];
     if (m->breakPoints && BreakReadCheck(m->breakPoints, address & m->mask)) {
@@ -239,6 +269,7 @@ static inline uint32_t CPUReadMemory(ARM7TDMI &cpu, uint32_t address)
 static inline uint32_t CPUReadHalfWord(ARM7TDMI &cpu, uint32_t address)
 {
     auto &g_ioMem = cpu.gba->mem.ioMem.b;
+    checkIdleLoopRead(cpu, address);
 #ifdef VBAM_ENABLE_DEBUGGER
     memoryMap* m = &map[address >> 24];
     if (m->breakPoints && BreakReadCheck(m->breakPoints, address & m->mask)) {
@@ -387,6 +418,7 @@ static inline int16_t CPUReadHalfWordSigned(ARM7TDMI &cpu, uint32_t address)
 static inline uint8_t CPUReadByte(ARM7TDMI &cpu, uint32_t address)
 {
     auto &g_ioMem = cpu.gba->mem.ioMem.b;
+    checkIdleLoopRead(cpu, address);
 #ifdef VBAM_ENABLE_DEBUGGER
     memoryMap* m = &map[address >> 24];
     if (m->breakPoints && BreakReadCheck(m->breakPoints, address & m->mask)) {
@@ -501,6 +533,8 @@ static inline void CPUWriteMemory(ARM7TDMI &cpu, uint32_t address, uint32_t valu
     }
 #endif
 
+    checkIdleLoopWrite(cpu);
+
     switch (address >> 24) {
     case 0x02:
 #ifdef VBAM_ENABLE_DEBUGGER
@@ -606,6 +640,8 @@ static inline void CPUWriteHalfWord(ARM7TDMI &cpu, uint32_t address, uint16_t va
     }
 #endif
 
+    checkIdleLoopWrite(cpu);
+
     switch (address >> 24) {
     case 2:
 #ifdef VBAM_ENABLE_DEBUGGER
@@ -705,6 +741,8 @@ static inline void CPUWriteByte(ARM7TDMI &cpu, uint32_t address, uint8_t b)
     }
 #endif
 
+    checkIdleLoopWrite(cpu);
+
     switch (address >> 24) {
     case 2:
 #ifdef VBAM_ENABLE_DEBUGGER
@@ -405,6 +405,16 @@ class CustomSystemOptionView : public SystemOptionView, public MainAppHelper
 		}
 	};
 
+	BoolMenuItem skipIdleLoops
+	{
+		"Skip Idle Loops", attachParams(),
+		coreOptions.skipIdleLoops,
+		[this](BoolMenuItem &item)
+		{
+			coreOptions.skipIdleLoops = item.flipBoolValue(*this);
+		}
+	};
+
 	#ifdef IG_CONFIG_SENSORS
 	TextMenuItem lightSensorScaleItem[5]
 	{
@@ -452,6 +462,7 @@ public:
 	{
 		loadStockItems();
 		item.emplace_back(&bios);
+		item.emplace_back(&skipIdleLoops);
 		#ifdef IG_CONFIG_SENSORS
 		item.emplace_back(&lightSensorScale);
 		#endif
@@ -5,6 +5,8 @@
 #include <core/gba/gba.h>
 #include <imagine/util/used.hh>
 #include <imagine/util/utility.h>
+#include <algorithm>
+#include <span>
 
 using MixColorType = uint16_t;
 struct GBALCD;
@@ -398,6 +400,9 @@ public:
 	bool armState{true};
 	bool armIrqEnable{true};
 	bool holdState{};
+	// idle loop detection state, only tracked while coreOptions.skipIdleLoops is set
+	bool memWritten{}; // set by any CPUWrite* call
+	bool volatileRead{}; // set by CPURead* calls that can change before the next event
 	//uint8_t cpuBitsSet[256];
 	//uint8_t cpuLowestBitSet[256];
 	GBASys *gba;
@@ -545,6 +550,42 @@ public:
 #endif
 	}
 
+	// CPU state when a short loop branched back to its head
+	struct IdleLoopSnapshot
+	{
+		static constexpr uint32_t maxLoopBytes = 32;
+
+		std::array<uint32_t, 16> reg;
+		uint32_t pc{1}; // odd address never matches a loop head
+		int mode;
+		bool n, z, c, v;
+	};
+
+	// Called after branching back to loopPC from within maxLoopBytes. If the loop
+	// starts again with the same registers and flags as its last iteration, no
+	// memory was written in between and none of its loads can change before the next
+	// event (see checkIdleLoopRead()), it will keep repeating until an event changes
+	// what it reads, so the caller can skip ahead to the next event like a HALT.
+	bool isIdleLoop(IdleLoopSnapshot &last, uint32_t loopPC)
+	{
+		bool idle = !memWritten && !volatileRead && loopPC == last.pc && armMode == last.mode &&
+			nFlag() == last.n && zFlag() == last.z && C_FLAG == last.c && V_FLAG == last.v &&
+			std::ranges::equal(std::span{reg}.first<16>(), last.reg, {}, &reg_pair::I);
+		if(!idle)
+		{
+			std::ranges::transform(std::span{reg}.first<16>(), last.reg.begin(), &reg_pair::I);
+			last.pc = loopPC;
+			last.mode = armMode;
+			last.n = nFlag();
+			last.z = zFlag();
+			last.c = C_FLAG;
+			last.v = V_FLAG;
+		}
+		memWritten = false;
+		volatileRead = false;
+		return idle;
+	}
+
 	void softReset(int b)
 	{
 		armState = true;
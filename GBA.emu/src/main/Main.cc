@@ -45,6 +45,7 @@ constexpr SystemLogger log{"GBA.emu"};
 const char *EmuSystem::creditsViewStr = CREDITS_INFO_STRING "(c) 2012-2025\nRobert Broglia\nwww.explusalpha.com\n\nPortions (c) the\nVBA-m Team\nvba-m.com";
 bool EmuSystem::hasBundledGames = true;
 bool EmuSystem::hasCheats = true;
+bool EmuSystem::usesGzipStates = true;
 bool EmuApp::needsGlobalInstance = true;
 constexpr WSize lcdSize{240, 160};
 
@@ -126,6 +127,10 @@ void GbaSystem::loadBackupMemory(EmuApp &app)
 		saveFileIO = {};
 	saveMemoryIsMappedFile = buff.isMappedFile();
 	setSaveMemory(std::move(buff));
+	if(saveMemoryIsMappedFile)
+		saveFileWriter.reset();
+	else
+		saveFileWriter.setWritten(eepromInUse ? eepromData.span() : flashSaveMemory.span());
 }
 
 void GbaSystem::onFlushBackupMemory(EmuApp &app, BackupMemoryDirtyFlags)
@@ -140,8 +145,14 @@ void GbaSystem::onFlushBackupMemory(EmuApp &app, BackupMemoryDirtyFlags)
 	}
 	else
 	{
-		log.info("saving backup memory");
-		saveFileIO.write(saveData.span(), 0);
+		auto bytes = saveFileWriter.flush(saveData.span(), [&](size_t offset, std::span<const uint8_t> data)
+		{
+			return saveFileIO.write(data, off_t(offset)).bytes == ssize_t(data.size());
+		});
+		if(bytes < 0)
+			log.error("error writing backup memory");
+		else
+			log.info("saved {} bytes of backup memory", bytes);
 	}
 }
 
@@ -155,12 +166,14 @@ void GbaSystem::closeSystem()
 	assert(hasContent());
 	CPUCleanUp();
 	saveFileIO = {};
+	saveFileWriter.reset();
 	coreOptions.saveType = GBA_SAVE_NONE;
 	detectedRtcGame = 0;
 	detectedSensorType = {};
 	sensorListener = {};
 	darknessLevel = darknessLevelDefault;
 	cheatsList.clear();
+	cheatsUpdateEnabledState();
 }
 
 void GbaSystem::applyGamePatches(uint8_t *rom, int &romSize)
@@ -17,6 +17,7 @@
 
 #include <emuframework/EmuSystem.hh>
 #include <emuframework/EmuOptions.hh>
+#include <emuframework/DirtyPageWriter.hh>
 #include <imagine/base/Sensor.hh>
 #include <imagine/io/FileIO.hh>
 #include <imagine/util/enum.hh>
@@ -43,7 +44,7 @@ enum
 	CFGKEY_SENSOR_TYPE = 262, CFGKEY_LIGHT_SENSOR_SCALE = 263,
 	CFGKEY_CHEATS_PATH = 264, CFGKEY_PATCHES_PATH = 265,
 	CFGKEY_USE_BIOS = 266, CFGKEY_DEFAULT_USE_BIOS = 267,
-	CFGKEY_BIOS_PATH = 268
+	CFGKEY_BIOS_PATH = 268, CFGKEY_SKIP_IDLE_LOOPS = 269
 };
 
 void setSaveType(int type, int size);
@@ -82,6 +83,7 @@ public:
 	Property<uint32_t, CFGKEY_SAVE_TYPE_OVERRIDE,
 		PropertyDesc<uint32_t>{.defaultValue = GBA_SAVE_AUTO, .isValid = optionSaveTypeOverrideIsValid}> optionSaveTypeOverride;
 	FileIO saveFileIO;
+	DirtyPageWriter saveFileWriter;
 	static constexpr size_t maxStateSize{0x1FFFFF};
 	size_t saveStateSize{};
 	int detectedSaveSize{};
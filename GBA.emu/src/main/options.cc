@@ -63,6 +63,7 @@ bool GbaSystem::readConfig(ConfigType type, MapIO &io, unsigned key)
 			case CFGKEY_PATCHES_PATH: return readStringOptionValue(io, patchesDir);
 			case CFGKEY_BIOS_PATH: return readStringOptionValue(io, biosPath);
 			case CFGKEY_DEFAULT_USE_BIOS: return readOptionValue(io, defaultUseBios);
+			case CFGKEY_SKIP_IDLE_LOOPS: return readOptionValue<bool>(io, [](auto on){coreOptions.skipIdleLoops = on;});
 		}
 	}
 	else if(type == ConfigType::SESSION)
@@ -92,6 +93,7 @@ void GbaSystem::writeConfig(ConfigType type, FileIO &io)
 		writeStringOptionValue(io, CFGKEY_PATCHES_PATH, patchesDir);
 		writeStringOptionValue(io, CFGKEY_BIOS_PATH, biosPath);
 		writeOptionValueIfNotDefault(io, defaultUseBios);
+		writeOptionValueIfNotDefault(io, CFGKEY_SKIP_IDLE_LOOPS, coreOptions.skipIdleLoops, false);
 	}
 	else if(type == ConfigType::SESSION)
 	{
@@ -26,6 +26,10 @@
 #include <resample/resamplerinfo.h>
 #include <libgambatte/src/mem/cartridge.h>
 #include <imagine/logger/logger.h>
+#include <imagine/thread/WorkThread.hh>
+#include <zlib.h>
+#include <atomic>
+#include <thread>
 
 namespace EmuEx
 {
@@ -238,10 +242,10 @@ size_t GbcSystem::runUntilVideoFrame(gambatte::uint_least32_t *videoBuf, std::pt
 		if(audio)
 		{
 			constexpr size_t buffSize = (snd.size() / (2097152./48000.) + 1); // TODO: std::ceil() is constexpr with GCC but not Clang yet
-			std::array<uint32_t, buffSize> destBuff;
-			unsigned destFrames = resampler->resample((short*)destBuff.data(), (const short*)snd.data(), samples);
-			assumeExpr(destFrames <= destBuff.size());
-			audio->writeFrames(destBuff.data(), destFrames);
+			auto destBuff = audio->beginWrite<short>(buffSize);
+			unsigned destFrames = resampler->resample(destBuff.data(), (const short*)snd.data(), samples);
+			assumeExpr(destFrames <= buffSize);
+			audio->commitWrite(destFrames);
 		}
 	} while(!didOutputFrame);
 	return samplesEmulated;
@@ -284,6 +288,80 @@ void GbcSystem::renderFramebuffer(EmuVideo &video)
 	renderVideo({}, video);
 }
 
+std::vector<BatchRunResult> GbcSystem::runBatch(std::span<const FS::PathString> paths, int frames, const ThreadStop &stop)
+{
+	std::vector<BatchRunResult> results(paths.size());
+	// battery saves go to a scratch directory, named by index so runs don't share them
+	auto saveDir = FS::createDirectorySegments(appContext().cachePath(), "BatchRun");
+	std::atomic_size_t nextIdx{};
+	auto runNext = [&]
+	{
+		// each worker owns a complete core instance, gambatte keeps no global state
+		auto gb = std::make_unique<gambatte::GB>();
+		GbcInput input;
+		gb->setInputGetter(&input);
+		auto frameBuff = std::make_unique<uint_least32_t[]>(gambatte::lcd_hres * gambatte::lcd_vres);
+		for(auto idx = nextIdx++; idx < paths.size(); idx = nextIdx++)
+		{
+			auto &result = results[idx];
+			result.path = paths[idx];
+			if(stop)
+			{
+				result.error = "Cancelled";
+				continue;
+			}
+			try
+			{
+				auto buff = appContext().openFileUri(paths[idx], {.accessHint = IOAccessHint::All}).buffer();
+				if(!buff)
+					throwFileReadError();
+				auto name = std::format("{}", idx);
+				FS::remove(FS::pathString(saveDir, name + ".sav"));
+				FS::remove(FS::pathString(saveDir, name + ".rtc"));
+				gb->setSaveDir(std::format("{}/", saveDir));
+				if(auto res = gb->load(buff.data(), buff.size(), name, optionReportAsGba ? gb->GBA_CGB : 0);
+					res != gambatte::LOADRES_OK)
+				{
+					throw std::runtime_error(gambatte::to_string(res));
+				}
+				auto startTime = SteadyClock::now();
+				for(auto f : iotaCount(frames))
+				{
+					if(stop.isQuitting())
+						throw std::runtime_error("Cancelled");
+					std::array<uint_least32_t, 2064 + 2064> snd;
+					size_t samples;
+					do
+					{
+						samples = 2064;
+					} while(gb->runFor(frameBuff.get(), gambatte::lcd_hres, snd.data(), samples, {}) == -1);
+					result.frames = f + 1;
+				}
+				result.time = SteadyClock::now() - startTime;
+				result.frameCrc = crc32(0, reinterpret_cast<const Bytef*>(frameBuff.get()),
+					gambatte::lcd_hres * gambatte::lcd_vres * sizeof(uint_least32_t));
+			}
+			catch(std::exception &err)
+			{
+				result.error = err.what();
+			}
+		}
+	};
+	auto threadCount = std::min(size_t(std::max(std::thread::hardware_concurrency(), 1u)), paths.size());
+	log.info("running {} files on {} threads", paths.size(), threadCount);
+	std::vector<std::thread> threads;
+	for([[maybe_unused]] auto i : iotaCount(threadCount - 1))
+	{
+		threads.emplace_back(runNext);
+	}
+	runNext();
+	for(auto &t : threads)
+	{
+		t.join();
+	}
+	return results;
+}
+
 void EmuApp::onCustomizeNavView(EmuApp::NavView &view)
 {
 	const Gfx::LGradientStopDesc navViewGrad[] =
@@ -139,6 +139,7 @@ public:
 	bool removeCheat(Cheat&);
 	void forEachCheat(DelegateFunc<bool(Cheat&, std::string_view)>);
 	void forEachCheatCode(Cheat&, DelegateFunc<bool(CheatCode&, std::string_view)>);
+	std::vector<BatchRunResult> runBatch(std::span<const FS::PathString> paths, int frames, const ThreadStop &);
 
 protected:
 	uint_least32_t makeOutputColor(uint_least32_t rgb888) const;
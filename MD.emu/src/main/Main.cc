@@ -30,7 +30,7 @@
 #ifndef NO_SCD
 #include <scd/scd.h>
 #include <mednafen/mednafen.h>
-#include <mednafen/cdrom/CDAccess.h>
+#include <mednafen/cdrom/CDInterface.h>
 #include <mednafen-emuex/ArchiveVFS.hh>
 #endif
 #include "Cheats.hh"
@@ -53,6 +53,9 @@ bool EmuSystem::hasCheats = true;
 bool EmuSystem::hasPALVideoSystem = true;
 bool EmuSystem::canRenderRGBA8888 = RENDER_BPP == 32;
 bool EmuSystem::hasRectangularPixels = true;
+#ifndef NO_SCD
+bool EmuSystem::usesDiscImages = true;
+#endif
 bool EmuApp::needsGlobalInstance = true;
 
 MdApp::MdApp(ApplicationInitParams initParams, ApplicationContext &ctx):
@@ -172,6 +175,7 @@ void MdSystem::loadBackupMemory(EmuApp &app)
 	{
 		auto saveStr = bramSaveFilename(app);
 		auto bramFile = appContext().openFileUri(saveStr, {.test = true, .accessHint = IOAccessHint::All});
+		bramWriter.reset();
 		if(!bramFile)
 		{
 			log.info("no BRAM on disk, formatting");
@@ -188,6 +192,14 @@ void MdSystem::loadBackupMemory(EmuApp &app)
 		{
 			bramFile.read(bram, sizeof(bram));
 			bramFile.read(sram.sram, 0x10000);
+			if(bramFile.size() == sizeof(bram) + 0x10000)
+			{
+				// track the file contents so the next save only writes changed pages
+				uint8_t bramImage[sizeof(bram) + 0x10000];
+				memcpy(bramImage, bram, sizeof(bram));
+				memcpy(bramImage + sizeof(bram), sram.sram, 0x10000);
+				bramWriter.setWritten(bramImage);
+			}
 			for(unsigned i = 0; i < 0x10000; i += 2) // byte-swap
 			{
 				std::swap(sram.sram[i], sram.sram[i+1]);
@@ -223,22 +235,32 @@ void MdSystem::onFlushBackupMemory(EmuApp &app, BackupMemoryDirtyFlags)
 	#ifndef NO_SCD
 	if(sCD.isActive)
 	{
-		log.info("saving BRAM");
+		// build the on-disk image and only write the pages that changed since the last save
+		uint8_t bramImage[sizeof(bram) + 0x10000];
+		memcpy(bramImage, bram, sizeof(bram));
+		auto sramTemp = bramImage + sizeof(bram);
+		memcpy(sramTemp, sram.sram, 0x10000); // make a temp copy to byte-swap
+		for(unsigned i = 0; i < 0x10000; i += 2)
+		{
+			std::swap(sramTemp[i], sramTemp[i+1]);
+		}
 		auto saveStr = bramSaveFilename(app);
-		auto bramFile = appContext().openFileUri(saveStr, OpenFlags::testNewFile());
-		if(!bramFile)
-			log.error("error creating bram file");
-		else
+		FileIO bramFile;
+		bool isFullWrite = !bramWriter.hasWrittenData();
+		auto bytes = bramWriter.flush(bramImage, [&](size_t offset, std::span<const uint8_t> data)
 		{
-			bramFile.write(bram, sizeof(bram));
-			char sramTemp[0x10000];
-			memcpy(sramTemp, sram.sram, 0x10000); // make a temp copy to byte-swap
-			for(unsigned i = 0; i < 0x10000; i += 2)
+			if(!bramFile)
 			{
-				std::swap(sramTemp[i], sramTemp[i+1]);
+				bramFile = appContext().openFileUri(saveStr, isFullWrite ? OpenFlags::testNewFile() : OpenFlags::testCreateFile());
+				if(!bramFile)
+					return false;
 			}
-			bramFile.write(sramTemp, 0x10000);
-		}
+			return bramFile.write(data, off_t(offset)).bytes == ssize_t(data.size());
+		});
+		if(bytes < 0)
+			log.error("error writing bram file");
+		else
+			log.info("saved {} bytes of BRAM", bytes);
 	}
 	else
 	#endif
@@ -325,8 +347,8 @@ void MdSystem::loadContent(IO &io, EmuSystemCreateParams, OnLoadProgressDelegate
 {
 	#ifndef NO_SCD
 	using namespace Mednafen;
-	CDAccess *cd{};
-	auto deleteCDAccess = IG::scopeGuard([&](){ delete cd; });
+	CDInterface *cd{};
+	auto deleteCDInterface = IG::scopeGuard([&](){ delete cd; });
 	if(hasMDCDExtension(contentFileName()) ||
 		(hasBinExtension(contentFileName()) && io.size() > 1024*1024*10)) // CD
 	{
@@ -359,11 +381,12 @@ void MdSystem::loadContent(IO &io, EmuSystemCreateParams, OnLoadProgressDelegate
 				io = std::move(*archIt);
 			}
 			ArchiveVFS archVFS{ArchiveIO{std::move(io)}};
-			cd = CDAccess_Open(&archVFS, std::string{contentFileName()}, true);
+			cd = CDInterface::Open(&archVFS, std::string{contentFileName()}, true, 0);
 		}
 		else
 		{
-			cd = CDAccess_Open(&NVFS, std::string{contentLocation()}, false);
+			auto memcacheBudget = EmuApp::get(appContext()).discImageMemCacheMaxSize();
+			cd = CDInterface::OpenWithMemcacheLimit(&NVFS, std::string{contentLocation()}, memcacheBudget, 0);
 		}
 
 		unsigned region = REGION_USA;
@@ -373,8 +396,8 @@ void MdSystem::loadContent(IO &io, EmuSystemCreateParams, OnLoadProgressDelegate
 	  else if (config.region_detect == 4) region = REGION_JAPAN_PAL;
 	  else
 	  {
-	  	uint8 bootSector[2048];
-	  	cd->Read_Sector(bootSector, 0, 2048);
+	  	uint8 bootSector[2048]{};
+	  	cd->ReadSectors(bootSector, 0, 1);
 			region = detectISORegion(bootSector);
 	  }
 
@@ -440,7 +463,7 @@ void MdSystem::loadContent(IO &io, EmuSystemCreateParams, OnLoadProgressDelegate
 		{
 			throw std::runtime_error("Error loading CD");
 		}
-		deleteCDAccess.cancel();
+		deleteCDInterface.cancel();
 	}
 	#endif
 
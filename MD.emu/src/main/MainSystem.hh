@@ -18,6 +18,7 @@
 #include <emuframework/EmuSystem.hh>
 #include <emuframework/EmuOptions.hh>
 #include <emuframework/Option.hh>
+#include <emuframework/DirtyPageWriter.hh>
 #include "Cheats.hh"
 #include "genplus-config.h"
 #include "system.h"
@@ -62,6 +63,7 @@ public:
 	Property<uint8_t, CFGKEY_VIDEO_SYSTEM, PropertyDesc<uint8_t>{.isValid = isValidWithMax<2>}> optionVideoSystem;
 	#ifndef NO_SCD
 	FS::PathString cdBiosUSAPath{}, cdBiosJpnPath{}, cdBiosEurPath{};
+	DirtyPageWriter bramWriter;
 	#endif
 	static constexpr size_t maxSaveStateSize = STATE_SIZE + 4;
 	static constexpr FrameRate ntscFrameRate{fromSeconds<SteadyClockDuration>(262. * MCYCLES_PER_LINE / 53693175.)}; // ~59.92Hz
@@ -18,7 +18,7 @@
 #include <stdio.h>
 #include <imagine/io/FileIO.hh>
 #include <mednafen/mednafen.h>
-#include <mednafen/cdrom/CDAccess.h>
+#include <mednafen/cdrom/CDInterface.h>
 
 #define cdprintf(x...)
 //#define cdprintf(f,...) printf(f "\n",##__VA_ARGS__) // tmp
@@ -31,14 +31,14 @@ bool MDFN_GetSettingB(const char *name) { return 0; }
 
 }
 
-static Mednafen::CDAccess *cdImage = nullptr;
+static Mednafen::CDInterface *cdImage = nullptr;
 
-int Load_ISO(Mednafen::CDAccess *cd)
+int Load_ISO(Mednafen::CDInterface *cd)
 {
 	using namespace Mednafen;
 	_scd_track *Tracks = sCD.TOC.Tracks;
 	CDUtility::TOC toc;
-	cd->Read_TOC(&toc);
+	cd->ReadTOC(&toc);
 	unsigned currLBA = 0;
 	sCD.cddaLBA = 0;
 	sCD.cddaDataLeftover = 0;
@@ -72,6 +72,13 @@ int Load_ISO(Mednafen::CDAccess *cd)
 void Unload_ISO(void)
 {
 	sCD.Status_CDD = 0;
+	if(cdImage)
+	{
+		auto stats = cdImage->GetReadStats();
+		logMsg("CD reads:%llu stalls:%llu (%llu us total, %llu us max)",
+			(unsigned long long)stats.reads, (unsigned long long)stats.stalls,
+			(unsigned long long)stats.stall_time_us, (unsigned long long)stats.max_stall_time_us);
+	}
 	delete cdImage;
 	cdImage = nullptr;
 	for(auto &track: sCD.TOC.Tracks)
@@ -82,12 +89,12 @@ void Unload_ISO(void)
 
 static void readLBA(void *dest, int lba)
 {
-	cdImage->Read_Sector((uint8*)dest, lba, 2048);
+	cdImage->ReadSector((uint8*)dest, lba, 2048);
 }
 
 static void readCddaLBA(void *dest, int lba)
 {
-	cdImage->Read_Sector((uint8*)dest, lba, 2352);
+	cdImage->ReadSector((uint8*)dest, lba, 2352);
 }
 
 int readCDDA(void *dest, unsigned size)
@@ -101,7 +108,7 @@ int readCDDA(void *dest, unsigned size)
 		{
 			//logMsg("reading %d frames of left-over CDDA", cddaDataLeftover);
 			int32 cddaSector[588];
-			cdImage->Read_Sector((uint8*)cddaSector, sCD.cddaLBA, 2352);
+			readCddaLBA(cddaSector, sCD.cddaLBA);
 			unsigned copySize = std::min((unsigned)sCD.cddaDataLeftover, sizeToWrite);
 			memcpy(cddaBuffPos, cddaSector + (588-sCD.cddaDataLeftover), copySize*4);
 			sCD.cddaDataLeftover -= copySize;
@@ -113,7 +120,7 @@ int readCDDA(void *dest, unsigned size)
 		while(sizeToWrite >= 588)
 		{
 			//logMsg("reading 588 frames");
-			cdImage->Read_Sector((uint8*)cddaBuffPos, sCD.cddaLBA, 2352);
+			readCddaLBA(cddaBuffPos, sCD.cddaLBA);
 			sCD.cddaLBA++;
 			cddaBuffPos += 588;
 			sizeToWrite -= 588;
@@ -122,7 +129,7 @@ int readCDDA(void *dest, unsigned size)
 		{
 			//logMsg("reading %d frames left", sizeToWrite);
 			int32 cddaSector[588];
-			cdImage->Read_Sector((uint8*)cddaSector, sCD.cddaLBA, 2352);
+			readCddaLBA(cddaSector, sCD.cddaLBA);
 			memcpy(cddaBuffPos, cddaSector, sizeToWrite*4);
 			sCD.cddaDataLeftover = 588 - sizeToWrite;
 		}
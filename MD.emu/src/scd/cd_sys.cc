@@ -14,7 +14,7 @@
 #include "cd_sys.h"
 #include "cd_file.h"
 #include <mednafen/mednafen.h>
-#include <mednafen/cdrom/CDAccess.h>
+#include <mednafen/cdrom/CDInterface.h>
 
 #define cdprintf(x...)
 //#define DEBUG_CD
@@ -203,7 +203,7 @@ void Reset_CD(void)
 }
 
 
-int Insert_CD(Mednafen::CDAccess *cd)
+int Insert_CD(Mednafen::CDInterface *cd)
 {
 	int ret = 0;
 
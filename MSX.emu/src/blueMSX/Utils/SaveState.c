@@ -30,6 +30,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <stdint.h>
 
 // Must be power of 2
 #define ALLOC_BLOCK_SIZE 256
@@ -39,11 +40,26 @@ struct SaveState {
     UInt32 size;
     UInt32 offset;
     UInt32 *buffer;
+    UInt32 external;
     char   fileName[64];
 };
 
 static char stateFile[512];
 
+// Flat memory state: a header followed by one record per state file, each record
+// being the file tag, its length in bytes, then the data padded to 32-bit words
+#define FLAT_STATE_MAGIC  0x54534d42 // "BMST"
+#define FLAT_HEADER_WORDS 2
+
+static struct {
+    UInt32* buffer;
+    UInt32  size;       // in 32-bit words
+    UInt32  offset;
+    UInt32  readOffset;
+    int     active;
+    int     overflow;
+} memState;
+
 static UInt32 tagFromName(const char* tagName)
 {
     UInt32 tag = 0;
@@ -103,8 +119,116 @@ static char* getIndexedFilename(const char* fileName)
     return indexedFileName;
 }
 
+static UInt32* memStateFind(UInt32 tag, UInt32* length)
+{
+    // records are normally read back in the order they were written so start
+    // from the end of the last match and only wrap around when it's missing
+    UInt32 startOffset = memState.readOffset;
+    UInt32 offset = startOffset;
+    int wrapAround = 0;
+
+    for (;;) {
+        UInt32 elemTag;
+        UInt32 elemLen;
+        UInt32 next;
+
+        if (wrapAround && offset >= startOffset) {
+            return NULL;
+        }
+        if (offset + 2 > memState.offset) {
+            if (wrapAround++) {
+                return NULL;
+            }
+            offset = FLAT_HEADER_WORDS;
+            continue;
+        }
+        elemTag = memState.buffer[offset];
+        elemLen = memState.buffer[offset + 1];
+        next = offset + 2 + (elemLen + sizeof(UInt32) - 1) / sizeof(UInt32);
+        if (next > memState.offset) {
+            offset = memState.offset;
+            continue;
+        }
+        if (elemTag == tag) {
+            memState.readOffset = next;
+            *length = elemLen;
+            return memState.buffer + offset + 2;
+        }
+        offset = next;
+    }
+}
+
+static void memStateAppend(UInt32 tag, const void* buffer, UInt32 length)
+{
+    UInt32 words = 2 + (length + sizeof(UInt32) - 1) / sizeof(UInt32);
+
+    if (memState.overflow || memState.offset + words > memState.size) {
+        memState.overflow = 1;
+        return;
+    }
+    memState.buffer[memState.offset++] = tag;
+    memState.buffer[memState.offset++] = length;
+    if (length) {
+        memcpy(memState.buffer + memState.offset, buffer, length);
+    }
+    memState.offset = memState.offset - 2 + words;
+}
+
+int saveStateIsMem(const void* buffer, UInt32 size)
+{
+    UInt32 magic;
+
+    if (size < FLAT_HEADER_WORDS * sizeof(UInt32)) {
+        return 0;
+    }
+    memcpy(&magic, buffer, sizeof(magic));
+    return magic == FLAT_STATE_MAGIC;
+}
+
+int saveStateCreateForReadMem(void* buffer, UInt32 size)
+{
+    UInt32 length;
+
+    if (!saveStateIsMem(buffer, size) || ((uintptr_t)buffer & (sizeof(UInt32) - 1))) {
+        return 0;
+    }
+    tableCount = 0;
+    stateFile[0] = 0;
+    memState.buffer = buffer;
+    length = memState.buffer[1];
+    memState.size = (length < size ? length : size) / sizeof(UInt32);
+    memState.offset = memState.size;
+    memState.readOffset = FLAT_HEADER_WORDS;
+    memState.overflow = 0;
+    memState.active = 1;
+    return 1;
+}
+
+void saveStateCreateForWriteMem(void* buffer, UInt32 size)
+{
+    tableCount = 0;
+    stateFile[0] = 0;
+    memState.buffer = buffer;
+    memState.size = size / sizeof(UInt32);
+    memState.offset = FLAT_HEADER_WORDS;
+    memState.readOffset = FLAT_HEADER_WORDS;
+    memState.overflow = memState.size < FLAT_HEADER_WORDS || ((uintptr_t)buffer & (sizeof(UInt32) - 1));
+    memState.active = 1;
+}
+
+UInt32 saveStateMemSize(void)
+{
+    if (!memState.active || memState.overflow) {
+        return 0;
+    }
+    memState.buffer[0] = FLAT_STATE_MAGIC;
+    memState.buffer[1] = memState.offset * sizeof(UInt32);
+    return memState.offset * sizeof(UInt32);
+}
+
 void saveStateCreateForRead(const char* fileName)
 {
+    memState.active = 0;
     tableCount = 0;
     strcpy(stateFile, fileName);
     zipCacheReadOnlyZip(fileName);
@@ -112,19 +236,37 @@ void saveStateCreateForRead(const char* fileName)
 
 void saveStateCreateForWrite(const char* fileName)
 {
+    memState.active = 0;
     tableCount = 0;
     strcpy(stateFile, fileName);
 }
 
 void saveStateDestroy(void)
 {
+    if (memState.active) {
+        memState.active = 0;
+        memState.buffer = NULL;
+        return;
+    }
     zipCacheReadOnlyZip(NULL);
 }
 
 SaveState* saveStateOpenForRead(const char* fileName) {
     SaveState* state = (SaveState*)malloc(sizeof(SaveState));
     Int32 size = 0;
-    void* buffer = zipLoadFile(stateFile, getIndexedFilename(fileName), &size);
+    void* buffer;
+
+    if (memState.active) {
+        // point directly into the flat state, the data is only read from
+        UInt32 length = 0;
+        buffer = memStateFind(tagFromName(getIndexedFilename(fileName)), &length);
+        size = buffer ? length : 0;
+        state->external = 1;
+    }
+    else {
+        buffer = zipLoadFile(stateFile, getIndexedFilename(fileName), &size);
+        state->external = 0;
+    }
 
     state->allocSize = size;
     state->buffer = buffer;
@@ -142,6 +284,7 @@ SaveState* saveStateOpenForWrite(const char* fileName) {
     state->offset    = 0;
     state->buffer    = NULL;
     state->allocSize = 0;
+    state->external  = 0;
 
     strcpy(state->fileName, getIndexedFilename(fileName));
 
@@ -150,9 +293,14 @@ SaveState* saveStateOpenForWrite(const char* fileName) {
 
 void saveStateClose(SaveState* state) {
     if (state->fileName[0]) {
-        zipSaveFile(stateFile, state->fileName, 1, state->buffer, state->offset * sizeof(UInt32));
+        if (memState.active) {
+            memStateAppend(tagFromName(state->fileName), state->buffer, state->offset * sizeof(UInt32));
+        }
+        else {
+            zipSaveFile(stateFile, state->fileName, 1, state->buffer, state->offset * sizeof(UInt32));
+        }
     }
-    if (state->buffer != NULL) {
+    if (state->buffer != NULL && !state->external) {
         free(state->buffer);
     }
     state->allocSize = 0;
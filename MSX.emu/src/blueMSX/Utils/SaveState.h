@@ -36,6 +36,13 @@ void saveStateCreateForRead(const char* fileName);
 void saveStateCreateForWrite(const char* fileName);
 void saveStateDestroy(void);
 
+// Flat in-memory states skip the zip container and compression, records are stored
+// back to back and normally read back in order. The buffer must be 32-bit aligned.
+int saveStateIsMem(const void* buffer, UInt32 size);
+int saveStateCreateForReadMem(void* buffer, UInt32 size);
+void saveStateCreateForWriteMem(void* buffer, UInt32 size);
+UInt32 saveStateMemSize(void); // bytes written, or 0 if the buffer was too small
+
 SaveState* saveStateOpenForRead(const char* fileName);
 SaveState* saveStateOpenForWrite(const char* fileName);
 void saveStateClose(SaveState* state);
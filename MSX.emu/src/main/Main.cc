@@ -466,7 +466,25 @@ void MsxSystem::saveBlueMSXState(const char *filename)
 		log.error("error writing to zip:{}", filename);
 		EmuSystem::throwFileWriteError();
 	}
+	saveBlueMSXStateData();
+	saveStateDestroy();
+	zipEndWrite();
+}
+
+size_t MsxSystem::saveBlueMSXFlatState(std::span<uint8_t> buff)
+{
+	saveStateCreateForWriteMem(buff.data(), buff.size());
+	SaveState* state = saveStateOpenForWrite("version");
+	saveStateSetBuffer(state, "version", (void*)saveStateVersion, sizeof(saveStateVersion));
+	saveStateClose(state);
+	saveBlueMSXStateData();
+	auto size = saveStateMemSize();
+	saveStateDestroy();
+	return size;
+}
 
+void MsxSystem::saveBlueMSXStateData()
+{
 	SaveState* state = saveStateOpenForWrite("board");
 
 	saveStateSet(state, "pendingInt", pendingInt);
@@ -492,8 +510,6 @@ void MsxSystem::saveBlueMSXState(const char *filename)
 
 	machineSaveState(machine);
 	boardInfo.saveState();
-	saveStateDestroy();
-	zipEndWrite();
 }
 
 static FS::FileString saveStateGetFileString(SaveState* state, const char* tagName)
@@ -527,7 +543,30 @@ void MsxSystem::loadBlueMSXState(EmuApp &app, const char *filename)
 		throw std::runtime_error("Incorrect state version");
 	}
 	free(version);
+	loadBlueMSXStateData(app);
+}
+
+void MsxSystem::loadBlueMSXFlatState(EmuApp &app, std::span<uint8_t> buff)
+{
+	assert(machine);
+	if(!saveStateCreateForReadMem(buff.data(), buff.size()))
+	{
+		EmuSystem::throwFileReadError();
+	}
+	auto destroySaveState = IG::scopeGuard([](){ saveStateDestroy(); });
+	std::array<char, sizeof(saveStateVersion)> version{};
+	SaveState* state = saveStateOpenForRead("version");
+	saveStateGetBuffer(state, "version", version.data(), version.size());
+	saveStateClose(state);
+	if(0 != strncmp(version.data(), saveStateVersion, sizeof(saveStateVersion) - 1))
+	{
+		throw std::runtime_error("Incorrect state version");
+	}
+	loadBlueMSXStateData(app);
+}
 
+void MsxSystem::loadBlueMSXStateData(EmuApp &app)
+{
 	ejectMedia();
 	machineLoadState(machine);
 
@@ -569,6 +608,12 @@ void MsxSystem::loadBlueMSXState(EmuApp &app, const char *filename)
 
 void MsxSystem::readState(EmuApp &app, std::span<uint8_t> buff)
 {
+	if(saveStateIsMem(buff.data(), buff.size()))
+	{
+		log.info("loading flat state");
+		loadBlueMSXFlatState(app, buff);
+		return;
+	}
 	setZipMemBuffer(buff);
 	loadBlueMSXState(app, ":::B");
 }
@@ -576,6 +621,14 @@ void MsxSystem::readState(EmuApp &app, std::span<uint8_t> buff)
 size_t MsxSystem::writeState(std::span<uint8_t> buff, SaveStateFlags flags)
 {
 	assert(buff.size() == stateSize());
+	if(flags.uncompressed)
+	{
+		// rewind & autosave snapshots skip the zip container, fall back to it
+		// if a machine with a large amount of RAM doesn't fit uncompressed
+		if(auto size = saveBlueMSXFlatState(buff))
+			return size;
+		log.info("flat state doesn't fit in {} bytes, using zip", buff.size());
+	}
 	setZipMemBuffer(buff);
 	saveBlueMSXState(":::B");
 	return zipMemBufferSize();
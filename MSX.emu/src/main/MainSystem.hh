@@ -230,7 +230,11 @@ public:
 private:
 	void insertMedia(EmuApp &app);
 	void saveBlueMSXState(const char *filename);
+	size_t saveBlueMSXFlatState(std::span<uint8_t> buff);
+	void saveBlueMSXStateData();
 	void loadBlueMSXState(EmuApp &app, const char *filename);
+	void loadBlueMSXFlatState(EmuApp &app, std::span<uint8_t> buff);
+	void loadBlueMSXStateData(EmuApp &app);
 };
 
 using MainSystem = MsxSystem;
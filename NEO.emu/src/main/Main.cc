@@ -96,6 +96,7 @@ const char *EmuSystem::creditsViewStr = CREDITS_INFO_STRING "(c) 2012-2025\nRobe
 bool EmuSystem::handlesGenericIO = false; // TODO: need to re-factor GnGeo file loading code
 bool EmuSystem::canRenderRGBA8888 = false;
 bool EmuSystem::hasRectangularPixels = true;
+bool EmuSystem::usesGzipStates = true;
 bool EmuApp::needsGlobalInstance = true;
 
 NeoApp::NeoApp(ApplicationInitParams initParams, ApplicationContext &ctx):
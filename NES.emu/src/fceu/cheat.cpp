@@ -28,6 +28,7 @@
 #include "driver.h"
 #include "utils/memory.h"
 #include <imagine/util/algorithm.h>
+#include <emuframework/CheatPatchTable.hh>
 
 #include <string>
 #include <cstdlib>
@@ -69,7 +70,14 @@ void FCEU_SetCheatChangeEventCallback( void (*func)(void*), void* userData )
 	cheatsChangeEventUserData = userData;
 }
 
-CHEATF_SUBFAST SubCheats[256];
+struct CHEATF_PERIODIC
+{
+	uint16 addr;
+	uint8 val;
+};
+
+static EmuEx::CheatPatchTable<CHEATF_SUBFAST> SubCheats;
+static EmuEx::CheatPatchTable<CHEATF_PERIODIC> PeriodicCheats;
 uint32 numsubcheats = 0;
 int globalCheatDisabled = 0;
 int disableAutoLSCheats = 0;
@@ -87,61 +95,68 @@ int savecheats = 0;
 
 static DECLFR(SubCheatsRead)
 {
-	CHEATF_SUBFAST *s = SubCheats;
-	int x=numsubcheats;
-
-	do
+	auto s = SubCheats.find(A);
+	if(!s)
+		return(0);	/* We should never get here. */
+	if(s->compare>=0)
 	{
-		if(s->addr==A)
-		{
-			if(s->compare>=0)
-			{
-				uint8 pv=s->PrevRead(A);
+		uint8 pv=s->PrevRead(A);
 
-				if(pv==s->compare)
-					return(s->val);
-				else return(pv);
-			}
-			else return(s->val);
-		}
-		s++;
-	} while(--x);
-	return(0);	/* We should never get here. */
+		if(pv==s->compare)
+			return(s->val);
+		else return(pv);
+	}
+	else return(s->val);
 }
 
 void RebuildSubCheats(void)
 {
-	uint32 x;
-	for (x = 0; x < numsubcheats; x++)
+	for(const auto &s: SubCheats)
 	{
-		SetReadHandler(SubCheats[x].addr, SubCheats[x].addr, SubCheats[x].PrevRead);
+		SetReadHandler(s.addr, s.addr, s.PrevRead);
 		if (cheatMap)
-			FCEUI_SetCheatMapByte(SubCheats[x].addr, false);
+			FCEUI_SetCheatMapByte(s.addr, false);
 	}
 
-	numsubcheats = 0;
+	SubCheats.clear();
+	PeriodicCheats.clear();
 
 	if (!globalCheatDisabled)
 	{
 		for(auto& cheat: cheats)
 		{
+			if(!cheat.status)
+				continue;
 			for(auto& code: cheat.codes)
 			{
 				auto c = &code;
-				if(c->type == 1 && cheat.status && GetReadHandler(c->addr) != SubCheatsRead)
+				if(c->type == 1)
 				{
-					SubCheats[numsubcheats].PrevRead = GetReadHandler(c->addr);
-					SubCheats[numsubcheats].addr = c->addr;
-					SubCheats[numsubcheats].val = c->val;
-					SubCheats[numsubcheats].compare = c->compare;
-					SetReadHandler(c->addr, c->addr, SubCheatsRead);
-					if (cheatMap)
-						FCEUI_SetCheatMapByte(SubCheats[numsubcheats].addr, true);
-					numsubcheats++;
+					CHEATF_SUBFAST s;
+					s.addr = c->addr;
+					s.val = c->val;
+					s.compare = c->compare;
+					s.PrevRead = GetReadHandler(c->addr);
+					SubCheats.add(s);
+				}
+				else
+				{
+					PeriodicCheats.add({c->addr, c->val});
 				}
 			}
 		}
+		SubCheats.compile();
+		// RAM codes were written in list order each frame, so the last one for an address wins
+		PeriodicCheats.compile(EmuEx::DuplicatePatch::KeepLast);
+		// Only the first code for an address is kept, install the lookup handler once per address
+		for(const auto &s: SubCheats)
+		{
+			SetReadHandler(s.addr, s.addr, SubCheatsRead);
+			if (cheatMap)
+				FCEUI_SetCheatMapByte(s.addr, true);
+		}
 	}
+	numsubcheats = SubCheats.size();
 	FrozenAddressCount = numsubcheats;		//Update the frozen address list
 
 	// Notify the system of a change
@@ -153,7 +168,8 @@ void RebuildSubCheats(void)
 
 void FCEU_PowerCheats()
 {
-	numsubcheats = 0;	/* Quick hack to prevent setting of ancient read addresses. */
+	SubCheats.clear();	/* Quick hack to prevent setting of ancient read addresses. */
+	numsubcheats = 0;
 	if (cheatMap)
 		FCEUI_RefreshCheatMap();
 	RebuildSubCheats();
@@ -213,6 +229,7 @@ void FCEU_LoadGameCheats(FILE *override, int override_existing)
 
 	if (override_existing)
 	{
+		SubCheats.clear();
 		numsubcheats = 0;
 		if (cheatMap)
 			FCEUI_RefreshCheatMap();
@@ -433,15 +450,11 @@ int FCEUI_DelCheat(uint32 which)
 
 void FCEU_ApplyPeriodicCheats(void)
 {
-	for(auto& cheat: cheats)
+	PeriodicCheats.apply([](const CHEATF_PERIODIC &p)
 	{
-		for(auto& code: cheat.codes)
-		{
-			if(cheat.status && !(code.type))
-				if(CheatRPtrs[code.addr>>10])
-					CheatRPtrs[code.addr>>10][code.addr]=code.val;
-		}
-	}
+		if(CheatRPtrs[p.addr>>10])
+			CheatRPtrs[p.addr>>10][p.addr]=p.val;
+	});
 }
 
 #if 0
@@ -933,8 +946,8 @@ void FCEUI_CreateCheatMap(void)
 void FCEUI_RefreshCheatMap(void)
 {
 	memset(cheatMap, 0, CHEATMAP_SIZE);
-	for (uint32 i = 0; i < numsubcheats; ++i)
-		FCEUI_SetCheatMapByte(SubCheats[i].addr, true);
+	for (const auto &s: SubCheats)
+		FCEUI_SetCheatMapByte(s.addr, true);
 }
 
 void FCEUI_ReleaseCheatMap(void)
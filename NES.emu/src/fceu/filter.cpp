@@ -93,6 +93,26 @@ void SexyFilter(int32 *in, int32 *out, int32 count)
    code to be higher, or you *might* overflow the FIR code.
 */
 
+/* Filters the N samples starting at S into acc, and the N samples starting at
+   S+1 into acc2, for interpolating between them. The filters are symmetric so
+   walking the samples and coefficients in the same direction gives the same
+   sums as the original backwards loop, but as unit stride loops over a
+   constant count the compiler can turn it into SIMD multiply-adds.
+*/
+template<uint32 N>
+static inline void FIRDot2(const int32 *__restrict S, const int32 *__restrict D, int32 &acc, int32 &acc2)
+{
+	uint32 a=0,a2=0;
+
+	for(uint32 c=0;c<N;c++)
+	{
+		a+=(S[c]*D[c])>>6;
+		a2+=(S[c+1]*D[c])>>6;
+	}
+	acc=a;
+	acc2=a2;
+}
+
 int32 NeoFilterSound(int32 *in, int32 *out, uint32 inlen, int32 *leftover)
 {
 	uint32 x;
@@ -109,16 +129,9 @@ int32 NeoFilterSound(int32 *in, int32 *out, uint32 inlen, int32 *leftover)
 	if(FSettings.soundq==2)
         for(x=mrindex;x<max;x+=mrratio)
         {
-			int32 acc=0,acc2=0;
-			unsigned int c;
-			int32 *S,*D;
-
-			for(c=SQ2NCOEFFS,S=&in[(x>>16)-SQ2NCOEFFS],D=sq2coeffs;c;c--,D++)
-			{
-				acc+=(S[c]**D)>>6;
-				acc2+=(S[1+c]**D)>>6;
-			}
+			int32 acc,acc2;
 
+			FIRDot2<SQ2NCOEFFS>(&in[(x>>16)-SQ2NCOEFFS+1],sq2coeffs,acc,acc2);
 			acc=((int64)acc*(65536-(x&65535))+(int64)acc2*(x&65535))>>(16+11);
 			*out=acc;
 			out++;
@@ -127,16 +140,9 @@ int32 NeoFilterSound(int32 *in, int32 *out, uint32 inlen, int32 *leftover)
 	else
 		for(x=mrindex;x<max;x+=mrratio)
 		{
-			int32 acc=0,acc2=0;
-			unsigned int c;
-			const int32 *S,*D;
-
-			for(c=NCOEFFS,S=&in[(x>>16)-NCOEFFS],D=coeffs;c;c--,D++)
-			{
-				acc+=(S[c]**D)>>6;
-				acc2+=(S[1+c]**D)>>6;
-			}
+			int32 acc,acc2;
 
+			FIRDot2<NCOEFFS>(&in[(x>>16)-NCOEFFS+1],coeffs,acc,acc2);
 			acc=((int64)acc*(65536-(x&65535))+(int64)acc2*(x&65535))>>(16+11);
 			*out=acc;
 			out++;
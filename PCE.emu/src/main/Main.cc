@@ -37,6 +37,8 @@ namespace EmuEx
 const char *EmuSystem::creditsViewStr = CREDITS_INFO_STRING "(c) 2011-2025\nRobert Broglia\nwww.explusalpha.com\n\nPortions (c) the\nMednafen Team\nmednafen.github.io";
 bool EmuSystem::hasRectangularPixels = true;
 bool EmuSystem::stateSizeChangesAtRuntime = true;
+bool EmuSystem::usesGzipStates = true;
+bool EmuSystem::usesDiscImages = true;
 constexpr double masterClockFrac = 21477272.727273 / 3.;
 constexpr auto pceFrameRateWith262Lines{fromSeconds<SteadyClockDuration>(455. * 262. / masterClockFrac)}; // ~60.05Hz
 constexpr auto pceFrameRate{fromSeconds<SteadyClockDuration>(455. * 263. / masterClockFrac)}; //~59.82Hz
@@ -134,7 +136,8 @@ void PceSystem::loadContent(IO &io, EmuSystemCreateParams, OnLoadProgressDelegat
 		}
 		else
 		{
-			CDInterfaces.push_back(CDInterface::Open(&NVFS, std::string{contentLocation()}, false, 0));
+			auto memcacheBudget = EmuApp::get(appContext()).discImageMemCacheMaxSize();
+			CDInterfaces.push_back(CDInterface::OpenWithMemcacheLimit(&NVFS, std::string{contentLocation()}, memcacheBudget, 0));
 		}
 		writeCDMD5(mdfnGameInfo, CDInterfaces);
 		mdfnGameInfo.LoadCD(&CDInterfaces);
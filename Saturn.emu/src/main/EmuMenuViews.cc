@@ -532,6 +532,7 @@ public:
 
 class CustomSystemOptionView : public SystemOptionView, public MainAppHelper
 {
+	using MainAppHelper::app;
 	using MainAppHelper::system;
 
 	BoolMenuItem autoSetRTC
@@ -567,6 +568,17 @@ class CustomSystemOptionView : public SystemOptionView, public MainAppHelper
 		}
 	};
 
+	BoolMenuItem threadedSound
+	{
+		"Run Sound CPU On Separate Thread", attachParams(),
+		system().threadedSound,
+		[this](BoolMenuItem &item, const Input::Event &e)
+		{
+			system().threadedSound = item.flipBoolValue(*this);
+			app().promptSystemReloadDueToSetOption(attachParams(), e);
+		}
+	};
+
 	BoolMenuItem saveFilenameType = saveFilenameTypeMenuItem(*this, system());
 
 public:
@@ -575,6 +587,7 @@ public:
 		loadStockItems();
 		item.emplace_back(&biosLanguage);
 		item.emplace_back(&autoSetRTC);
+		item.emplace_back(&threadedSound);
 		item.emplace_back(&saveFilenameType);
 	}
 };
@@ -55,6 +55,8 @@ bool EmuSystem::hasRectangularPixels = true;
 bool EmuSystem::hasPALVideoSystem = true;
 bool EmuSystem::canRenderRGB565 = false;
 bool EmuSystem::stateSizeChangesAtRuntime = true;
+bool EmuSystem::usesGzipStates = true;
+bool EmuSystem::usesDiscImages = true;
 bool EmuApp::needsGlobalInstance = true;
 
 constexpr EmuSystem::BackupMemoryDirtyFlags sramDirtyBit = bit(0);
@@ -299,9 +301,10 @@ void SaturnSystem::loadContent(IO &io, EmuSystemCreateParams, OnLoadProgressDele
 		{
 			filenames.emplace_back(contentLocation());
 		}
+		auto memcacheBudget = EmuApp::get(appContext()).discImageMemCacheMaxSize(); // shared by all discs in a set
 		for(auto &fn : filenames)
 		{
-			CDInterfaces.emplace_back(CDInterface::Open(&NVFS, std::move(fn), false, 0));
+			CDInterfaces.emplace_back(CDInterface::OpenWithMemcacheLimit(&NVFS, std::move(fn), memcacheBudget, 0));
 		}
 	}
 	if(!CDInterfaces.size())
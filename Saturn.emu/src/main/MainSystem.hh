@@ -21,6 +21,7 @@
 #include <ss/ss.h>
 #include <ss/smpc.h>
 #include <ss/cart.h>
+#include <atomic>
 
 extern const Mednafen::MDFNGI EmulatedSS;
 
@@ -33,6 +34,7 @@ namespace MDFN_IEN_SS
 {
 extern Mednafen::CDInterface* Cur_CDIF;
 extern IG::ThreadId RThreadId;
+extern std::atomic<IG::ThreadId> SThreadId;
 extern const int ActiveCartType;
 extern uint8 AreaCode;
 }
@@ -85,7 +87,7 @@ enum
 	CFGKEY_DEFAULT_NTSC_VIDEO_LINES = 287, CFGKEY_DEFAULT_PAL_VIDEO_LINES = 288,
 	CFGKEY_DEFAULT_SHOW_H_OVERSCAN = 289, CFGKEY_SHOW_H_OVERSCAN = 290,
 	CFGKEY_DEINTERLACE_MODE = 291, CFGKEY_WIDESCREEN_MODE = 292,
-	CFGKEY_NO_MD5_FILENAMES = 293
+	CFGKEY_NO_MD5_FILENAMES = 293, CFGKEY_THREADED_SOUND = 294
 };
 
 struct VideoLineRange
@@ -132,6 +134,7 @@ public:
 	bool correctLineAspect{};
 	bool autoRTCTime{true};
 	bool noMD5InFilenames{};
+	bool threadedSound{};
 	Rotation sysContentRotation{Rotation::ANY};
 	WidescreenMode widescreenMode{WidescreenMode::Auto};
 
@@ -194,7 +197,12 @@ public:
 	bool onPointerInputStart(const Input::MotionEvent &e, Input::DragTrackerState, WRect gameRect);
 	bool onPointerInputEnd(const Input::MotionEvent &, Input::DragTrackerState, WRect);
 	Rotation contentRotation() const;
-	void addThreadGroupIds(std::vector<ThreadId> &ids) const { ids.emplace_back(MDFN_IEN_SS::RThreadId); }
+	void addThreadGroupIds(std::vector<ThreadId> &ids) const
+	{
+		ids.emplace_back(MDFN_IEN_SS::RThreadId);
+		if(auto id = MDFN_IEN_SS::SThreadId.load())
+			ids.emplace_back(id);
+	}
 };
 
 using MainSystem = SaturnSystem;
@@ -80,6 +80,7 @@ bool SaturnSystem::readConfig(ConfigType type, MapIO &io, unsigned key)
 			case CFGKEY_DEFAULT_PAL_VIDEO_LINES: return readOptionValue(io, defaultPalLines, linesAreValid<288>);
 			case CFGKEY_DEFAULT_SHOW_H_OVERSCAN: return readOptionValue(io, defaultShowHOverscan);
 			case CFGKEY_NO_MD5_FILENAMES: return readOptionValue(io, noMD5InFilenames);
+			case CFGKEY_THREADED_SOUND: return readOptionValue(io, threadedSound);
 		}
 	}
 	else if(type == ConfigType::SESSION)
@@ -113,6 +114,7 @@ void SaturnSystem::writeConfig(ConfigType type, FileIO &io)
 		writeOptionValueIfNotDefault(io, CFGKEY_DEFAULT_PAL_VIDEO_LINES, defaultPalLines, safePalLines);
 		writeOptionValueIfNotDefault(io, CFGKEY_DEFAULT_SHOW_H_OVERSCAN, defaultShowHOverscan, false);
 		writeOptionValueIfNotDefault(io, CFGKEY_NO_MD5_FILENAMES, noMD5InFilenames, false);
+		writeOptionValueIfNotDefault(io, CFGKEY_THREADED_SOUND, threadedSound, false);
 	}
 	else if(type == ConfigType::SESSION)
 	{
@@ -209,6 +211,8 @@ bool MDFN_GetSettingB(const char *name_)
 		return !sys.region;
 	if("ss.smpc.autortc" == name)
 		return sys.autoRTCTime;
+	if("ss.scsp.thread" == name)
+		return sys.threadedSound;
 	if("ss.input.sport1.multitap" == name)
 		return false; // multitaps are handled in onSessionOptionsLoaded()
 	if("ss.input.sport2.multitap" == name)
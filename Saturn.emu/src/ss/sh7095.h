@@ -65,7 +65,8 @@ class SH7095 final
  }
 
  // When entering Step(), EmulateICache and DebugMode must match what was passed to Init() and SetDebugMode()
- template<unsigned which, bool EmulateICache, bool DebugMode>
+ // SoundThreaded makes fetches from sound RAM wait for the SCSP thread, and is only needed without EmulateICache
+ template<unsigned which, bool EmulateICache, bool DebugMode, bool SoundThreaded>
  void Step(void);
 
  // Slave only
@@ -476,7 +477,7 @@ class SH7095 final
  uint8 GetPendingInt(uint8*);
  void RecalcPendingIntPEX(void);
 
- template<bool EmulateICache, bool DebugMode, bool IntPreventNext>
+ template<bool EmulateICache, bool DebugMode, bool SoundThreaded, bool IntPreventNext>
  INLINE void DoIDIF_INLINE(void);
 
  template<bool SlavePenalty, typename T, bool BurstHax>
@@ -28,6 +28,10 @@
 #include <mednafen/resampler/resampler.h>
 #include <mednafen/hw_cpu/m68k/m68k.h>
 #include <mednafen/jump.h>
+#include <mednafen/MThreading.h>
+#include <imagine/thread/Thread.hh>
+#include <imagine/util/container/RingBuffer.hh>
+#include <atomic>
 
 #ifndef MDFN_SSFPLAY_COMPILE
 #include "ss.h"
@@ -62,6 +66,50 @@ static SpeexResamplerState* resampler = NULL;
 static int last_rate;
 static uint32 last_quality;
 
+//
+// Optional sound thread, runs the 68K and SCSP behind the SH-2s. Bus writes, CD-DA samples, and
+// run requests are queued in order, reads from the main bus wait for the queue to drain.
+//
+static MThreading::Thread* SThread = NULL;
+std::atomic<IG::ThreadId> SThreadId{};
+
+enum
+{
+ COMMAND_RUN = 0,
+ COMMAND_WRITE8,
+ COMMAND_WRITE16,
+ COMMAND_CDDA,
+ COMMAND_SET_68K_ACTIVE,
+ COMMAND_RESET_68K,
+ COMMAND_RESET_SCSP,
+ COMMAND_ADJUST_TS,
+ COMMAND_EXIT
+};
+
+struct SQ_Entry
+{
+ uint16 Command;
+ uint16 Arg16;
+ uint32 Arg32;
+ uint64 Arg64;
+};
+
+// Also bounds how far the sound thread can fall behind
+static IG::RingBuffer<SQ_Entry, {.fixedSize = 0x100}> SQ;
+
+static INLINE void WSQ(uint16 command, uint32 arg32 = 0, uint16 arg16 = 0, uint64 arg64 = 0)
+{
+ SQ.push({command, arg16, arg32, arg64}, {.blocking = true, .flushSize = 32});
+}
+
+static uint64 cdda_time;	// 32.32, main thread
+static uint32 CDDAQueue[16];	// sound thread
+static unsigned CDDAQueueRP, CDDAQueueCount;
+
+static std::atomic_uint32_t MainIntEdges;
+static std::atomic_bool MainIntLevel;
+static bool MainIntApplied;
+
 static INLINE void SCSP_SoundIntChanged(SS_SCSP* s, unsigned level)
 {
  SoundCPU.SetIPL(level);
@@ -70,10 +118,83 @@ static INLINE void SCSP_SoundIntChanged(SS_SCSP* s, unsigned level)
 static INLINE void SCSP_MainIntChanged(SS_SCSP* s, bool state)
 {
  #ifndef MDFN_SSFPLAY_COMPILE
+ if(SThread)
+ {
+  // Passed to the SCU by ApplyMainInt(), keep rising edges so a short pulse still latches the interrupt
+  if(state && !MainIntLevel.load(std::memory_order_relaxed))
+   MainIntEdges.fetch_add(1, std::memory_order_relaxed);
+  MainIntLevel.store(state, std::memory_order_release);
+  return;
+ }
  SCU_SetInt(SCU_INT_SCSP, state);
  #endif
 }
 
+static INLINE void ApplyMainInt(void)
+{
+ #ifndef MDFN_SSFPLAY_COMPILE
+ const bool level = MainIntLevel.load(std::memory_order_acquire);
+
+ if(MainIntEdges.exchange(0, std::memory_order_relaxed))
+ {
+  SCU_SetInt(SCU_INT_SCSP, false);
+  SCU_SetInt(SCU_INT_SCSP, true);
+  MainIntApplied = true;
+ }
+
+ if(level != MainIntApplied)
+ {
+  SCU_SetInt(SCU_INT_SCSP, level);
+  MainIntApplied = level;
+ }
+ #endif
+}
+
+// Waits until the sound thread has finished all queued commands, after which its state can be accessed directly
+void SOUND_SyncThread(void)
+{
+ if(!SThread)
+  return;
+
+ SQ.waitForSize(0);
+ ApplyMainInt();
+}
+
+static INLINE void GetCDDA(uint16* outbuf)
+{
+ if(!SThread)
+ {
+  CDB_GetCDDA(outbuf);
+  return;
+ }
+
+ outbuf[0] = outbuf[1] = 0;
+
+ if(CDDAQueueCount)
+ {
+  outbuf[0] = CDDAQueue[CDDAQueueRP];
+  outbuf[1] = CDDAQueue[CDDAQueueRP] >> 16;
+
+  CDDAQueueRP = (CDDAQueueRP + 1) % 16;
+  CDDAQueueCount--;
+ }
+}
+
+// Pull CD-DA samples on the main thread at the rate the SCSP consumes them
+static INLINE void QueueCDDA(uint64 run_delta)
+{
+ cdda_time += run_delta;
+
+ while(cdda_time >= ((uint64)256 << 32))
+ {
+  uint16 s[2] = { 0, 0 };
+
+  cdda_time -= (uint64)256 << 32;
+  CDB_GetCDDA(s);
+  WSQ(COMMAND_CDDA, s[0] | (s[1] << 16));
+ }
+}
+
 #include "scsp.inc"
 
 //
@@ -98,7 +219,10 @@ void SOUND_SetMIDIOutput(void (*p)(uint8))
  MIDI_Out = p;
 }
 
-void SOUND_Init(bool stv_mapping)
+static void RunSoundCPU(void);
+static int SThreadEntry(void* data);
+
+void SOUND_Init(bool stv_mapping, bool threaded)
 {
  memset(IBuffer, 0, sizeof(IBuffer));
  IBufferCount = 0;
@@ -147,45 +271,74 @@ void SOUND_Init(bool stv_mapping)
 
  SS_SetPhysMemMap(0x05A00000, 0x05A7FFFF, SCSP.GetRAMPtr(), 0x80000, true);
  // TODO: MEM4B: SS_SetPhysMemMap(0x05A00000, 0x05AFFFFF, SCSP.GetRAMPtr(), 0x40000, true);
+
+ cdda_time = 0;
+ CDDAQueueRP = CDDAQueueCount = 0;
+ MainIntEdges = 0;
+ MainIntLevel = false;
+ MainIntApplied = false;
+
+ if(threaded)
+ {
+  SQ.clear();
+  SThread = MThreading::Thread_Create(SThreadEntry, NULL, "MDFN SCSP");
+  SThreadId.wait(IG::ThreadId{});	// so it's known to addThreadGroupIds() once loading returns
+ }
 }
 
 uint8 SOUND_PeekRAM(uint32 A)
 {
+ SOUND_SyncThread();
+
  return ne16_rbo_be<uint8>(SCSP.GetRAMPtr(), A & 0x7FFFF);
 }
 
 void SOUND_PokeRAM(uint32 A, uint8 V)
 {
+ SOUND_SyncThread();
+
  ne16_wbo_be<uint8>(SCSP.GetRAMPtr(), A & 0x7FFFF, V);
 }
 
 uint64 SOUND_PeekMPROG(uint32 A)
 {
+ SOUND_SyncThread();
+
  return SCSP.PeekMPROG(A);
 }
 
 void SOUND_PokeMPROG(uint32 A, uint64 V)
 {
+ SOUND_SyncThread();
+
  SCSP.PokeMPROG(A, V);
 }
 
 uint32 SOUND_PeekTEMPRel(uint32 A)
 {
+ SOUND_SyncThread();
+
  return SCSP.PeekTEMPRel(A);
 }
 
 void SOUND_PokeTEMPRel(uint32 A, uint32 V)
 {
+ SOUND_SyncThread();
+
  SCSP.PokeTEMPRel(A, V);
 }
 
 uint32 SOUND_PeekMEMS(uint32 A)
 {
+ SOUND_SyncThread();
+
  return SCSP.PeekMEMS(A);
 }
 
 void SOUND_PokeMEMS(uint32 A, uint32 V)
 {
+ SOUND_SyncThread();
+
  SCSP.PokeMEMS(A, V);
 }
 
@@ -199,7 +352,10 @@ static INLINE void ResetTS_68K(void)
 
 void SOUND_AdjustTS(const int32 delta)
 {
- ResetTS_68K();
+ if(SThread)
+  WSQ(COMMAND_ADJUST_TS);
+ else
+  ResetTS_68K();
  //
  //
  lastts += delta;
@@ -207,22 +363,39 @@ void SOUND_AdjustTS(const int32 delta)
 
 void SOUND_Reset(bool powering_up)
 {
+ SOUND_SyncThread();
+
  SCSP.Reset(powering_up);
  SoundCPU.Reset(powering_up);
 }
 
 void SOUND_Reset68K(void)
 {
- SoundCPU.Reset(false);
+ if(SThread)
+  WSQ(COMMAND_RESET_68K);
+ else
+  SoundCPU.Reset(false);
 }
 
 void SOUND_ResetSCSP(void)
 {
- SCSP.Reset(false);
+ if(SThread)
+  WSQ(COMMAND_RESET_SCSP);
+ else
+  SCSP.Reset(false);
 }
 
 void SOUND_Kill(void)
 {
+ if(SThread)
+ {
+  WSQ(COMMAND_EXIT);
+  SQ.notifyWrite();
+  MThreading::Thread_Wait(SThread, NULL);
+  SThread = NULL;
+  SThreadId.store({});
+ }
+
  if(resampler)
  {
   speex_resampler_destroy(resampler);  
@@ -232,13 +405,18 @@ void SOUND_Kill(void)
 
 void SOUND_Set68KActive(bool active)
 {
- SoundCPU.SetExtHalted(!active);
+ if(SThread)
+  WSQ(COMMAND_SET_68K_ACTIVE, active);
+ else
+  SoundCPU.SetExtHalted(!active);
 }
 
 uint16 SOUND_Read16(uint32 A)
 {
  uint16 ret;
 
+ SOUND_SyncThread();
+
  SCSP.RW<uint16, false>(A, ret);
 
  return ret;
@@ -246,17 +424,23 @@ uint16 SOUND_Read16(uint32 A)
 
 void SOUND_Write8(uint32 A, uint8 V)
 {
- SCSP.RW<uint8, true>(A, V);
+ if(SThread)
+  WSQ(COMMAND_WRITE8, A, V);
+ else
+  SCSP.RW<uint8, true>(A, V);
 }
 
 void SOUND_Write16(uint32 A, uint16 V)
 {
- SCSP.RW<uint16, true>(A, V);
+ if(SThread)
+  WSQ(COMMAND_WRITE16, A, V);
+ else
+  SCSP.RW<uint16, true>(A, V);
 }
 
 static NO_INLINE void RunSCSP(void)
 {
- CDB_GetCDDA(SCSP.GetEXTSPtr());
+ GetCDDA(SCSP.GetEXTSPtr());
  //
  //
  int16* const bp = IBuffer[IBufferCount];
@@ -287,12 +471,8 @@ void SOUND_SetClockRatio(uint32 ratio)
  clock_ratio = ratio;
 }
 
-sscpu_timestamp_t SOUND_Update(sscpu_timestamp_t timestamp)
+static void RunSoundCPU(void)
 {
- run_until_time += ((uint64)(timestamp - lastts) * clock_ratio);
- lastts = timestamp;
- //
- //
  MDFN_setjmp(jbuf);
 
  if(MDFN_LIKELY(SoundCPU.timestamp < (run_until_time >> 32)))
@@ -312,10 +492,105 @@ sscpu_timestamp_t SOUND_Update(sscpu_timestamp_t timestamp)
   while(next_scsp_time < (run_until_time >> 32))
    RunSCSP();
  }
+}
+
+sscpu_timestamp_t SOUND_Update(sscpu_timestamp_t timestamp)
+{
+ const uint64 run_delta = (uint64)(timestamp - lastts) * clock_ratio;
+
+ lastts = timestamp;
+ //
+ //
+ if(SThread)
+ {
+  QueueCDDA(run_delta);
+  WSQ(COMMAND_RUN, 0, 0, run_delta);
+  ApplyMainInt();
+ }
+ else
+ {
+  run_until_time += run_delta;
+  RunSoundCPU();
+ }
 
  return timestamp + 128;	// FIXME
 }
 
+static int SThreadEntry(void* data)
+{
+ SThreadId.store(IG::thisThreadId());
+ SThreadId.notify_all();
+
+ while(true)
+ {
+  // Only release the entry after running it so SOUND_SyncThread() waits for the work to finish
+  auto span = SQ.beginRead(1, {.blocking = true});
+
+  if(!span.size())
+   continue;
+
+  const SQ_Entry* sqe = &span[0];
+
+  switch(sqe->Command)
+  {
+   case COMMAND_RUN:
+	run_until_time += sqe->Arg64;
+	RunSoundCPU();
+	break;
+
+   case COMMAND_WRITE8:
+	{
+	 uint8 V = sqe->Arg16;
+	 SCSP.RW<uint8, true>(sqe->Arg32, V);
+	}
+	break;
+
+   case COMMAND_WRITE16:
+	{
+	 uint16 V = sqe->Arg16;
+	 SCSP.RW<uint16, true>(sqe->Arg32, V);
+	}
+	break;
+
+   case COMMAND_CDDA:
+	if(CDDAQueueCount == 16)
+	{
+	 CDDAQueueRP = (CDDAQueueRP + 1) % 16;
+	 CDDAQueueCount--;
+	}
+	CDDAQueue[(CDDAQueueRP + CDDAQueueCount) % 16] = sqe->Arg32;
+	CDDAQueueCount++;
+	break;
+
+   case COMMAND_SET_68K_ACTIVE:
+	SoundCPU.SetExtHalted(!sqe->Arg32);
+	break;
+
+   case COMMAND_RESET_68K:
+	SoundCPU.Reset(false);
+	break;
+
+   case COMMAND_RESET_SCSP:
+	SCSP.Reset(false);
+	break;
+
+   case COMMAND_ADJUST_TS:
+	ResetTS_68K();
+	break;
+  }
+
+  const bool exiting = sqe->Command == COMMAND_EXIT;
+
+  SQ.endRead(span);
+  SQ.notifyRead();
+
+  if(exiting)
+   break;
+ }
+
+ return 0;
+}
+
 void SOUND_StartFrame(double rate, uint32 quality)
 {
  if((int)rate != last_rate || quality != last_quality)
@@ -340,6 +615,8 @@ void SOUND_StartFrame(double rate, uint32 quality)
 
 int32 SOUND_FlushOutput(int16* SoundBuf, const int32 SoundBufMaxSize, const bool reverse)
 {
+ SOUND_SyncThread();
+
  if(SoundBuf && reverse)
  {
   for(unsigned lr = 0; lr < 2; lr++)
@@ -403,6 +680,11 @@ void SOUND_StateAction(StateMem* sm, const unsigned load, const bool data_only)
   SFEND
  };
 
+ SOUND_SyncThread();
+
+ if(load)
+  CDDAQueueRP = CDDAQueueCount = 0;
+
  //
  next_scsp_time -= SoundCPU.timestamp;
  run_until_time -= (int64)SoundCPU.timestamp << 32;
@@ -589,21 +871,29 @@ static MDFN_FASTCALL void SoundCPU_BusRESET(bool state)
 
 uint32 SOUND_GetSCSPRegister(const unsigned id, char* const special, const uint32 special_len)
 {
+ SOUND_SyncThread();
+
  return SCSP.GetRegister(id, special, special_len);
 }
 
 void SOUND_SetSCSPRegister(const unsigned id, const uint32 value)
 {
+ SOUND_SyncThread();
+
  SCSP.SetRegister(id, value);
 }
 
 uint32 SOUND_GetM68KRegister(const unsigned id, char* const special, const uint32 special_len)
 {
+ SOUND_SyncThread();
+
  return SoundCPU.GetRegister(id, special, special_len);
 }
 
 void SOUND_SetM68KRegister(const unsigned id, const uint32 value)
 {
+ SOUND_SyncThread();
+
  SoundCPU.SetRegister(id, value);
 }
 
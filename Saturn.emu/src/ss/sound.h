@@ -25,7 +25,7 @@
 namespace MDFN_IEN_SS
 {
 
-void SOUND_Init(bool stv_mapping) MDFN_COLD;
+void SOUND_Init(bool stv_mapping, bool threaded = false) MDFN_COLD;
 void SOUND_SetMIDIOutput(void (*p)(uint8)) MDFN_COLD;
 void SOUND_Reset(bool powering_up) MDFN_COLD;
 void SOUND_Kill(void) MDFN_COLD;
@@ -35,6 +35,7 @@ void SOUND_Reset68K(void);
 void SOUND_ResetSCSP(void);
 
 void SOUND_SetClockRatio(uint32 ratio); // Ratio between SH-2 clock and 68K clock (sound clock / 2)
+void SOUND_SyncThread(void);	// Waits for the sound thread, if used, before sound RAM is accessed directly
 sscpu_timestamp_t SOUND_Update(sscpu_timestamp_t timestamp);
 void SOUND_AdjustTS(const int32 delta);
 void SOUND_StartFrame(double rate, uint32 quality);
@@ -101,6 +101,7 @@ static std::vector<CDInterface*> DBGCDInterfaces;
 uint32 ss_horrible_hacks;
 
 static bool NeedEmuICache;
+static bool NeedSoundFetchSync;
 static const uint8 BRAM_Init_Data[0x10] = { 0x42, 0x61, 0x63, 0x6b, 0x55, 0x70, 0x52, 0x61, 0x6d, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x61, 0x74 };
 
 static void SaveBackupRAM(void);
@@ -384,6 +385,9 @@ static MDFN_COLD uint8 CheatMemRead(uint32 A)
 {
  A &= (1U << 27) - 1;
 
+ if((A >> 20) == 0x5A)
+  SOUND_SyncThread();
+
  return ne16_rbo_be<uint8>(SH7095_FastMap[A >> SH7095_EXT_MAP_GRAN_BITS], A);
 }
 
@@ -391,6 +395,9 @@ static MDFN_COLD void CheatMemWrite(uint32 A, uint8 V)
 {
  A &= (1U << 27) - 1;
 
+ if((A >> 20) == 0x5A)
+  SOUND_SyncThread();
+
  if(FMIsWriteable[A >> SH7095_EXT_MAP_GRAN_BITS])
  {
   ne16_wbo_be<uint8>(SH7095_FastMap[A >> SH7095_EXT_MAP_GRAN_BITS], A, V);
@@ -696,7 +703,7 @@ void SS_RequestMLExit(void)
  #pragma GCC push_options
  #pragma GCC optimize("O2,no-unroll-loops,no-peel-loops,no-crossjumping")
 #endif
-template<bool EmulateICache, bool DebugMode>
+template<bool EmulateICache, bool DebugMode, bool SoundThreaded>
 static INLINE int32 RunLoop_INLINE(EmulateSpecStruct* espec)
 {
  sscpu_timestamp_t eff_ts = 0;
@@ -722,7 +729,7 @@ static INLINE int32 RunLoop_INLINE(EmulateSpecStruct* espec)
      DBG_CPUHandler<0>();
     }
 
-    CPU[0].Step<0, EmulateICache, DebugMode>();
+    CPU[0].Step<0, EmulateICache, DebugMode, SoundThreaded>();
     CPU[0].DMA_BusTimingKludge();
 
     if(EmulateICache)
@@ -739,7 +746,7 @@ static INLINE int32 RunLoop_INLINE(EmulateSpecStruct* espec)
       if(DebugMode)
        DBG_CPUHandler<1>();
 
-      CPU[1].Step<1, false, DebugMode>();
+      CPU[1].Step<1, false, DebugMode, SoundThreaded>();
      }
     }
 
@@ -756,16 +763,16 @@ static INLINE int32 RunLoop_INLINE(EmulateSpecStruct* espec)
  return eff_ts;
 }
 
-template<bool EmulateICache>
+template<bool EmulateICache, bool SoundThreaded>
 static NO_INLINE MDFN_HOT int32 RunLoop(EmulateSpecStruct* espec)
 {
- return RunLoop_INLINE<EmulateICache, false>(espec);
+ return RunLoop_INLINE<EmulateICache, false, SoundThreaded>(espec);
 }
 
-template<bool EmulateICache>
+template<bool EmulateICache, bool SoundThreaded>
 static NO_INLINE MDFN_COLD int32 RunLoop_Debug(EmulateSpecStruct* espec)
 {
- return RunLoop_INLINE<EmulateICache, true>(espec);
+ return RunLoop_INLINE<EmulateICache, true, SoundThreaded>(espec);
 }
 
 #if defined(__GNUC__) && !defined(__clang__)
@@ -876,18 +883,19 @@ static void Emulate(EmulateSpecStruct* espec_arg)
  //
  //
 #ifdef WANT_DEBUGGER
- #define RLTDAT(eic) RunLoop_Debug<eic>
+ #define RLTDAT(eic, st) RunLoop_Debug<eic, st>
 #else
- #define RLTDAT(eic) RunLoop<eic>
+ #define RLTDAT(eic, st) RunLoop<eic, st>
 #endif
- static int32 (*const rltab[2][2])(EmulateSpecStruct*) =
+ static int32 (*const rltab[3][2])(EmulateSpecStruct*) =
  {
-  //DebugMode=false  DebugMode=true
-  { RunLoop<false>, RLTDAT(false) },	// EmulateICache=false
-  { RunLoop<true>,  RLTDAT(true)  },	// EmulateICache=true
+  //DebugMode=false         DebugMode=true
+  { RunLoop<false, false>, RLTDAT(false, false) },	// EmulateICache=false
+  { RunLoop<true, false>,  RLTDAT(true, false)  },	// EmulateICache=true
+  { RunLoop<false, true>,  RLTDAT(false, true)  },	// EmulateICache=false, sound thread running
  };
 #undef RLTDAT
- end_ts = rltab[NeedEmuICache][DBG_NeedCPUHooks()](espec);
+ end_ts = rltab[NeedSoundFetchSync ? 2 : NeedEmuICache][DBG_NeedCPUHooks()](espec);
  assert(end_ts >= 0);
  ForceEventUpdates(end_ts);
  //
@@ -1474,7 +1482,17 @@ static void MDFN_COLD InitCommon(unsigned cpucache_emumode, unsigned horrible_ha
  VDP1::Init();
  VDP2::Init(PAL, vdp2_affinity);
  CDB_Init();
- SOUND_Init(cart_type == CART_STV);
+ //
+ // The cache bypass hack reads sound RAM through the SH-2 fast map without going through the sound code,
+ // so it can't be used with the sound thread.
+ //
+ {
+  const bool sound_thread = MDFN_GetSettingB("ss.scsp.thread") && cpucache_emumode != CPUCACHE_EMUMODE_DATA_CB;
+
+  SOUND_Init(cart_type == CART_STV, sound_thread);
+  // Without icache emulation, instruction fetches read sound RAM through the fast map too
+  NeedSoundFetchSync = sound_thread && !NeedEmuICache;
+ }
 
  {
   const unsigned midi_io = MDFN_GetSettingUI("ss.midi");
@@ -2456,6 +2474,8 @@ static const MDFNSetting SSSettings[] =
 
  { "ss.affinity.vdp2", MDFNSF_NOFLAGS, gettext_noop("VDP2 rendering thread CPU affinity mask."), gettext_noop("Set to 0 to disable changing affinity."), MDFNST_UINT, "0", "0x0000000000000000", "0xFFFFFFFFFFFFFFFF" },
 
+ { "ss.scsp.thread", MDFNSF_NOFLAGS, gettext_noop("Run SCSP and sound 68K emulation on a separate thread."), gettext_noop("Spreads emulation across more CPU cores, at the cost of slightly delayed sound interrupts to the SH-2s."), MDFNST_BOOL, "0" },
+
 #ifdef MDFN_ENABLE_DEV_BUILD
  { "ss.dbg_mask", MDFNSF_SUPPRESS_DOC, gettext_noop("Debug printf mask."), NULL, MDFNST_MULTI_ENUM, "none", NULL, NULL, NULL, NULL, DBGMask_List },
 #endif
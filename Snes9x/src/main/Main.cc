@@ -45,6 +45,7 @@ bool EmuSystem::hasPALVideoSystem = true;
 bool EmuSystem::hasResetModes = true;
 bool EmuSystem::canRenderRGBA8888 = false;
 bool EmuSystem::hasRectangularPixels = true;
+bool EmuSystem::usesGzipStates = true;
 bool EmuApp::needsGlobalInstance = true;
 
 EmuSystem::NameFilterFunc EmuSystem::defaultFsFilter =
@@ -333,12 +334,17 @@ static void mixSamples(int samples, EmuAudio *audio)
 	if(!samples) [[unlikely]]
 		return;
 	assumeExpr(samples % 2 == 0);
-	int16_t audioBuff[1800];
-	S9xMixSamples((uint8*)audioBuff, samples);
 	if(audio)
 	{
 		//logMsg("%d frames", samples / 2);
-		audio->writeFrames(audioBuff, samples / 2);
+		auto audioBuff = audio->beginWrite(samples / 2);
+		S9xMixSamples(audioBuff.data(), samples);
+		audio->commitWrite(samples / 2);
+	}
+	else
+	{
+		int16_t audioBuff[1800];
+		S9xMixSamples((uint8*)audioBuff, samples);
 	}
 }
 
@@ -232,6 +232,8 @@ public:
 	void flushSystemInputEvents();
 	void flushInternalInputEvents();
 	bool hasInputDeviceHotSwap() const;
+	bool hasInputDeviceThread() const;
+	void setInputDeviceThread(bool on); // read input devices on a dedicated thread if supported
 
 	// App exit
 	void exit(int returnVal);
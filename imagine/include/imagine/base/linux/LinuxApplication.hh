@@ -22,7 +22,12 @@
 #include <gio/gio.h>
 #endif
 #include <imagine/base/EventLoop.hh>
+#include <imagine/base/MessagePort.hh>
 #include <memory>
+#include <thread>
+#include <span>
+
+struct input_event;
 
 struct _XDisplay;
 union _XEvent;
@@ -56,9 +61,34 @@ public:
 	void setAcceptIPC(bool on, const char *name);
 	const FS::PathString &appPath() const;
 	void setAppPath(FS::PathString);
+	void setInputDeviceThread(bool on);
+	bool hasInputDeviceThread() const { return evdevThread.joinable(); }
+	EventLoop inputDeviceThreadEventLoop() const { return evdevThreadLoop; }
+	void postInputDeviceEvents(int devId, std::span<const input_event>);
+	void postInputDeviceError(int devId);
 
 protected:
+	// devices are referenced by id since they may be removed before the message is handled
+	struct EvdevThreadMessage
+	{
+		int devId{-1};
+		uint16_t events{};
+		bool error{};
+		bool detached{}; // input thread stopped polling the device, it can now be removed
+
+		explicit operator bool() const { return devId != -1; }
+	};
+
+	struct EvdevThreadCommand
+	{
+		Input::Device *detachDevPtr{}; // stops polling the device on the input thread, exits the thread if null
+	};
+
 	FDEventSource evdevSrc;
+	MessagePort<EvdevThreadMessage> evdevThreadMsgPort{"Evdev Thread Events"};
+	MessagePort<EvdevThreadCommand> evdevThreadCommandPort{"Evdev Thread Commands"};
+	std::thread evdevThread;
+	EventLoop evdevThreadLoop;
 	#if CONFIG_PACKAGE_DBUS
 	GDBusConnection *gbus{};
 	unsigned openPathSub{};
@@ -70,6 +100,7 @@ protected:
 	bool initDBus();
 	void deinitDBus();
 	void initEvdev(EventLoop);
+	void deinitEvdevThread();
 };
 
 }
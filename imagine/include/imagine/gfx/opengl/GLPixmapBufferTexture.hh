@@ -23,6 +23,7 @@
 #include <memory>
 #include <variant>
 #include <array>
+#include <atomic>
 
 namespace IG::Gfx
 {
@@ -30,7 +31,7 @@ namespace IG::Gfx
 class RendererTask;
 class PixmapBufferTexture;
 
-template<class Impl, class BufferInfo>
+template<class Impl, class BufferInfo, size_t bufferCount = 2>
 class GLTextureStorage: public Texture
 {
 public:
@@ -48,19 +49,17 @@ public:
 
 protected:
 	int8_t bufferIdx{};
-	std::array<BufferInfo, 2> info{};
-	static constexpr int8_t SINGLE_BUFFER_VALUE = 2;
+	std::array<BufferInfo, bufferCount> info{};
+	static constexpr int8_t SINGLE_BUFFER_VALUE = bufferCount;
 
-	BufferInfo currentBuffer() const
-	{
-		return isSingleBuffered() ? info[0] : info[bufferIdx];
-	}
+	int currentBufferIdx() const { return isSingleBuffered() ? 0 : bufferIdx; }
+	BufferInfo currentBuffer() const { return info[currentBufferIdx()]; }
 
 	void swapBuffer()
 	{
 		if(isSingleBuffered())
 			return;
-		bufferIdx = (bufferIdx + 1) % 2;
+		bufferIdx = (bufferIdx + 1) % bufferCount;
 	}
 };
 
@@ -90,16 +89,35 @@ struct GLPixelBufferInfo
 	void *dataStoreOffset() const { return pboDataOffset; }
 };
 
-class GLPixelBufferStorage final: public GLTextureStorage<GLPixelBufferStorage, GLPixelBufferInfo>
+// Fences signaled when the GPU finishes reading each slice of a pixel buffer ring
+struct GLPixelBufferFences
+{
+	std::array<std::atomic<GLsync>, 3> syncs{};
+	uint8_t pendingMask{};
+};
+
+struct GLPixelBufferFencesDeleter
+{
+	RendererTask *rTask{};
+
+	void operator()(GLPixelBufferFences *) const;
+};
+
+// Persistently mapped PBO split into a ring of 3 slices, a slice is only
+// written again after the fence from its last texture upload has signaled
+class GLPixelBufferStorage final: public GLTextureStorage<GLPixelBufferStorage, GLPixelBufferInfo, 3>
 {
 public:
 	constexpr GLPixelBufferStorage() = default;
 	GLPixelBufferStorage(RendererTask &rTask, TextureConfig config, bool singleBuffer);
 	void initBuffer(PixmapDesc desc, bool singleBuffer);
 	GLuint pbo() const { return pixelBuff.get(); }
+	void acquireBuffer(int idx);
+	void releaseBuffer(int idx);
 
 private:
 	UniqueGLBuffer pixelBuff{};
+	std::unique_ptr<GLPixelBufferFences, GLPixelBufferFencesDeleter> fences{};
 };
 
 using GLPixmapBufferTextureVariant = std::variant<
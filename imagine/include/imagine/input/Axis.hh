@@ -51,6 +51,7 @@ public:
 	Axis(AxisId, float scaler = 1.f);
 	void setEmulatesKeys(Map, bool);
 	bool emulatesKeys() const;
+	const AxisKeyEmu &keyEmulation() const { return keyEmu; }
 	constexpr AxisId id() const { return id_; }
 	AxisFlags idBit() const;
 	bool isTrigger() const;
@@ -52,6 +52,7 @@ namespace IG::Input
 {
 
 class Axis;
+class KeyStateSnapshot;
 
 struct KeyNameFlags
 {
@@ -184,6 +185,17 @@ public:
 				return std::span<Axis>{};
 		});
 	}
+	// pushed keys updated by the thread servicing the device, if supported
+	const KeyStateSnapshot *keyStateSnapshot() const
+	{
+		return visit([&](auto &d) -> const KeyStateSnapshot*
+		{
+			if constexpr(requires {d.keyStateSnapshot();})
+				return d.keyStateSnapshot();
+			else
+				return nullptr;
+		});
+	}
 	const char *keyName(Key k) const;
 	void setICadeMode(bool on);
 	[[nodiscard]]
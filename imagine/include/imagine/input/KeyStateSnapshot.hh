@@ -0,0 +1,83 @@
+#pragma once
+
+/*  This file is part of Imagine.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with Imagine.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/input/inputDefs.hh>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace IG::Input
+{
+
+// Currently pushed keys of a device, written by the thread reading the device and
+// sampled lock-free by any other thread. A reader only needs to copy the keys when
+// sequence() differs from its last sample.
+class KeyStateSnapshot
+{
+public:
+	static constexpr size_t maxKeys = 16;
+	using Keys = std::array<Key, maxKeys>; // unused slots are 0
+
+	constexpr KeyStateSnapshot() = default;
+
+	// only called from the writing thread
+	void setPushed(Key key, bool pushed)
+	{
+		if(!key)
+			return;
+		auto findSlot = [&](Key k) { return std::ranges::find_if(keys_, [&](auto &s){ return s.load(std::memory_order_relaxed) == k; }); };
+		auto it = findSlot(key);
+		if(pushed)
+		{
+			if(it != keys_.end())
+				return;
+			it = findSlot(0);
+			if(it == keys_.end()) [[unlikely]]
+				return;
+			it->store(key, std::memory_order_relaxed);
+		}
+		else
+		{
+			if(it == keys_.end())
+				return;
+			it->store(0, std::memory_order_relaxed);
+		}
+		seq.fetch_add(1, std::memory_order_release);
+	}
+
+	void clear()
+	{
+		for(auto &k : keys_) { k.store(0, std::memory_order_relaxed); }
+		seq.fetch_add(1, std::memory_order_release);
+	}
+
+	uint32_t sequence() const { return seq.load(std::memory_order_acquire); }
+
+	Keys keys() const
+	{
+		Keys k;
+		std::ranges::transform(keys_, k.begin(), [](auto &s){ return s.load(std::memory_order_relaxed); });
+		return k;
+	}
+
+protected:
+	std::array<std::atomic<Key>, maxKeys> keys_{};
+	std::atomic_uint32_t seq{};
+};
+
+}
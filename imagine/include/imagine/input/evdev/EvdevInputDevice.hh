@@ -16,6 +16,7 @@
 	along with Imagine.  If not, see <http://www.gnu.org/licenses/> */
 
 #include <imagine/input/Axis.hh>
+#include <imagine/input/KeyStateSnapshot.hh>
 #include <imagine/base/EventLoop.hh>
 #include <imagine/util/container/ArrayList.hh>
 #include <imagine/util/memory/UniqueFileDescriptor.hh>
@@ -36,15 +37,20 @@ public:
 	EvdevInputDevice(int id, UniqueFileDescriptor fd, DeviceTypeFlags, std::string name, uint32_t vendorProductId);
 	std::span<Axis> motionAxes() { return axis; };
 	int fd() const { return fdSrc.fd(); }
+	const KeyStateSnapshot *keyStateSnapshot() const { return &keyState; }
 	static void addPollEvent(Device&, LinuxApplication&);
+	static void removePollEvent(Device&);
+	static void processInputEvents(Device&, LinuxApplication&, std::span<const input_event>);
 
 protected:
 	static constexpr unsigned AXIS_SIZE = 24;
 	StaticArrayList<Axis, AXIS_SIZE> axis;
 	std::array<int, AXIS_SIZE> axisRangeOffset{};
+	std::array<int8_t, AXIS_SIZE> snapshotAxisState{};
+	KeyStateSnapshot keyState;
 	FDEventSource fdSrc;
 
-	static void processInputEvents(Device&, LinuxApplication&, std::span<const input_event>);
+	void updateKeyState(std::span<const input_event>);
 	bool setupJoystickBits();
 };
 
@@ -0,0 +1,51 @@
+#pragma once
+
+/*  This file is part of Imagine.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with Imagine.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/util/DelegateFunc.hh>
+#include <imagine/vmem/memory.hh>
+#include <cstddef>
+
+namespace IG
+{
+
+// Stackful coroutine with its own stack that runs on whichever thread calls resume(),
+// control returns to that thread when the fiber calls yield(). The function must not
+// return and the fiber's stack isn't unwound when destroyed. The stack is mapped with an
+// inaccessible guard page below it so an overflow faults instead of corrupting memory.
+class Fiber
+{
+public:
+	static constexpr size_t defaultStackSize = 1024 * 1024;
+
+	Fiber() = default;
+	Fiber(DelegateFunc<void()>, size_t stackSize = defaultStackSize);
+	Fiber(Fiber&&) = delete;
+	void resume();
+	void yield();
+	bool isActive() const { return callerSp; }
+	explicit operator bool() const { return bool(stack); }
+
+private:
+	UniqueVPtr<std::byte> stack;
+	void *fiberSp{};
+	void *callerSp{};
+	DelegateFunc<void()> func;
+
+	[[noreturn]] static void entry();
+};
+
+}
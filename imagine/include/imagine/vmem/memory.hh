@@ -29,6 +29,7 @@ extern uintptr_t pageSize;
 std::span<uint8_t> vAlloc(size_t bytes);
 std::span<uint8_t> vAllocMirrored(size_t bytes);
 void vFree(std::span<uint8_t>);
+bool vProtectNone(std::span<uint8_t>); // page-aligned range faults on any access
 
 inline uintptr_t truncPageSize(uintptr_t addr)
 {
@@ -36,6 +36,7 @@ LinuxApplication::LinuxApplication(ApplicationInitParams initParams):
 
 LinuxApplication::~LinuxApplication()
 {
+	deinitEvdevThread();
 	deinitDBus();
 }
 
@@ -148,4 +148,8 @@ bool ApplicationContext::registerInstance(ApplicationInitParams initParams, cons
 
 void ApplicationContext::setAcceptIPC(bool on, const char *name) { application().setAcceptIPC(on, name); }
 
+bool ApplicationContext::hasInputDeviceThread() const { return true; }
+
+void ApplicationContext::setInputDeviceThread(bool on) { application().setInputDeviceThread(on); }
+
 }
@@ -22,6 +22,7 @@
 #endif
 #include <cerrno>
 #include <sys/stat.h>
+#include <fcntl.h>
 #include <cstdlib>
 #include <cstring>
 #include <system_error>
@@ -340,4 +341,17 @@ bool rename(CStringView oldPath, CStringView newPath)
 	return true;
 }
 
+bool last_write_time(CStringView path, file_time_type newTime)
+{
+	auto secs = std::chrono::duration_cast<std::chrono::seconds>(newTime.time_since_epoch()).count();
+	struct timespec times[2]{{.tv_sec = 0, .tv_nsec = UTIME_OMIT}, {.tv_sec = time_t(secs), .tv_nsec = 0}};
+	if(::utimensat(AT_FDCWD, path, times, 0) == -1) [[unlikely]]
+	{
+		if(Config::DEBUG_BUILD)
+			logErr("utimensat(%s) error:%s", path.data(), strerror(errno));
+		return false;
+	}
+	return true;
+}
+
 }
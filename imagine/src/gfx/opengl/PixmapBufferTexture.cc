@@ -19,6 +19,8 @@
 #include <imagine/util/ScopeGuard.hh>
 #include <imagine/util/utility.h>
 #include <imagine/util/math.hh>
+#include <imagine/util/ranges.hh>
+#include <imagine/util/bit.hh>
 #ifdef __ANDROID__
 #include <imagine/gfx/opengl/android/HardwareBufferStorage.hh>
 #include <imagine/gfx/opengl/android/SurfaceTextureStorage.hh>
@@ -229,21 +231,25 @@ bool PixmapBufferTexture::isExternal() const
 		visit([&](auto &t){ return t.target() == GL_TEXTURE_EXTERNAL_OES; }, directTex);
 }
 
-template<class Impl, class BufferInfo>
-bool GLTextureStorage<Impl, BufferInfo>::setFormat(PixmapDesc desc, ColorSpace colorSpace, TextureSamplerConfig samplerConf)
+template<class Impl, class BufferInfo, size_t bufferCount>
+bool GLTextureStorage<Impl, BufferInfo, bufferCount>::setFormat(PixmapDesc desc, ColorSpace colorSpace, TextureSamplerConfig samplerConf)
 {
 	static_cast<Impl*>(this)->initBuffer(desc, isSingleBuffered());
 	return Texture::setFormat(desc, 1, colorSpace, samplerConf);
 }
 
-template<class Impl, class BufferInfo>
-LockedTextureBuffer GLTextureStorage<Impl, BufferInfo>::lock(TextureBufferFlags bufferFlags)
+template<class Impl, class BufferInfo, size_t bufferCount>
+LockedTextureBuffer GLTextureStorage<Impl, BufferInfo, bufferCount>::lock(TextureBufferFlags bufferFlags)
 {
 	if(!texName()) [[unlikely]]
 	{
 		logErr("called lock when uninitialized");
 		return {};
 	}
+	if constexpr(requires {static_cast<Impl*>(this)->acquireBuffer(0);})
+	{
+		static_cast<Impl*>(this)->acquireBuffer(currentBufferIdx());
+	}
 	auto bufferInfo = currentBuffer();
 	IG::WindowRect fullRect{{}, size(0)};
 	MutablePixmapView pix{{fullRect.size(), pixmapDesc().format}, bufferInfo.data};
@@ -257,15 +263,20 @@ LockedTextureBuffer GLTextureStorage<Impl, BufferInfo>::lock(TextureBufferFlags
 	return {bufferInfo.dataStoreOffset(), pix, fullRect, 0, false, pbo};
 }
 
-template<class Impl, class BufferInfo>
-void GLTextureStorage<Impl, BufferInfo>::unlock(LockedTextureBuffer lockBuff, TextureWriteFlags writeFlags)
+template<class Impl, class BufferInfo, size_t bufferCount>
+void GLTextureStorage<Impl, BufferInfo, bufferCount>::unlock(LockedTextureBuffer lockBuff, TextureWriteFlags writeFlags)
 {
 	Texture::unlock(lockBuff, writeFlags);
+	if constexpr(requires {static_cast<Impl*>(this)->releaseBuffer(0);})
+	{
+		if(lockBuff)
+			static_cast<Impl*>(this)->releaseBuffer(currentBufferIdx());
+	}
 	swapBuffer();
 }
 
-template<class Impl, class BufferInfo>
-void GLTextureStorage<Impl, BufferInfo>::writeAligned(PixmapView pixmap, int assumeAlign, TextureWriteFlags writeFlags)
+template<class Impl, class BufferInfo, size_t bufferCount>
+void GLTextureStorage<Impl, BufferInfo, bufferCount>::writeAligned(PixmapView pixmap, int assumeAlign, TextureWriteFlags writeFlags)
 {
 	if(renderer().support.hasUnpackRowLength || !pixmap.isPadded())
 	{
@@ -304,6 +315,8 @@ GLPixelBufferStorage::GLPixelBufferStorage(RendererTask &rTask, TextureConfig co
 	GLTextureStorage{rTask, config, singleBuffer},
 	pixelBuff{GLBufferDeleter{&rTask}}
 {
+	if(rTask.renderer().support.hasSyncFences())
+		fences = {new GLPixelBufferFences, GLPixelBufferFencesDeleter{&rTask}};
 	initBuffer(config.pixmapDesc, singleBuffer);
 }
 
@@ -312,8 +325,13 @@ void GLPixelBufferStorage::initBuffer(PixmapDesc desc, bool singleBuffer)
 	const auto bufferBytes = desc.bytes();
 	auto &r = renderer();
 	assert(hasPersistentBufferMapping(r));
+	if(fences)
+	{
+		for(auto i: iotaCount(info.size())) { acquireBuffer(i); }
+	}
 	char *bufferPtr{};
-	const auto fullBufferBytes = singleBuffer ? bufferBytes : bufferBytes * 2;
+	const auto bufferCount = singleBuffer ? 1 : info.size();
+	const auto fullBufferBytes = bufferBytes * bufferCount;
 	task().runSync(
 		[=, &r, &bufferPtr, &pbo = pixelBuff.get()](GLTask::TaskContext ctx)
 		{
@@ -344,13 +362,12 @@ void GLPixelBufferStorage::initBuffer(PixmapDesc desc, bool singleBuffer)
 		});
 	if(bufferPtr)
 	{
-		logMsg("allocated PBO:%u with buffers:%u size:%u data:%p", pixelBuff.get(), singleBuffer ? 1 : 2, bufferBytes, bufferPtr);
-		info[0] = {bufferPtr, nullptr};
-		if(singleBuffer)
-			info[1] = {nullptr};
-		else
+		logMsg("allocated PBO:%u with buffers:%u size:%u data:%p", pixelBuff.get(), (unsigned)bufferCount, bufferBytes, bufferPtr);
+		info = {};
+		for(auto i: iotaCount(bufferCount))
 		{
-			info[1] = {bufferPtr + bufferBytes, (void *)(uintptr_t)bufferBytes};
+			auto offset = bufferBytes * i;
+			info[i] = {bufferPtr + offset, (void *)(uintptr_t)offset};
 		}
 	}
 	else [[unlikely]]
@@ -359,8 +376,45 @@ void GLPixelBufferStorage::initBuffer(PixmapDesc desc, bool singleBuffer)
 	}
 }
 
+void GLPixelBufferStorage::acquireBuffer(int idx)
+{
+	if(!fences || !(fences->pendingMask & bit(idx)))
+		return;
+	auto &sync = fences->syncs[idx];
+	if(!sync.load(std::memory_order_acquire)) [[unlikely]]
+	{
+		// renderer thread hasn't processed the upload from this slice yet
+		task().awaitPending();
+	}
+	task().clientWaitSync(sync.exchange({}, std::memory_order_acquire));
+	fences->pendingMask &= ~bit(idx);
+}
+
+void GLPixelBufferStorage::releaseBuffer(int idx)
+{
+	if(!fences)
+		return;
+	auto &r = renderer();
+	// queued after the texture upload so it signals once the GPU is done reading the slice
+	task().run([&support = r.support, dpy = r.glDisplay(), &sync = fences->syncs[idx]]()
+	{
+		sync.store(support.fenceSync(dpy), std::memory_order_release);
+	});
+	fences->pendingMask |= bit(idx);
+}
+
+void GLPixelBufferFencesDeleter::operator()(GLPixelBufferFences *fences) const
+{
+	rTask->awaitPending();
+	for(auto &sync: fences->syncs)
+	{
+		rTask->deleteSyncFence(sync.load(std::memory_order_acquire));
+	}
+	delete fences;
+}
+
 template class GLTextureStorage<GLSystemMemoryStorage, GLSystemMemoryBufferInfo>;
-template class GLTextureStorage<GLPixelBufferStorage, GLPixelBufferInfo>;
+template class GLTextureStorage<GLPixelBufferStorage, GLPixelBufferInfo, 3>;
 
 #ifdef __ANDROID__
 static const char *rendererGLStr(Renderer &r)
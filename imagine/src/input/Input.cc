@@ -356,6 +356,10 @@ void ApplicationContext::flushInternalInputEvents()
 
 [[gnu::weak]] bool ApplicationContext::hasInputDeviceHotSwap() const { return Config::Input::DEVICE_HOTSWAP; }
 
+[[gnu::weak]] bool ApplicationContext::hasInputDeviceThread() const { return false; }
+
+[[gnu::weak]] void ApplicationContext::setInputDeviceThread(bool) {}
+
 [[gnu::weak]] void ApplicationContext::flushSystemInputEvents() {}
 
 bool BaseApplication::processICadeKey(const Input::KeyEvent &e, Window &win)
@@ -22,6 +22,7 @@
 #include <imagine/input/AxisKeyEmu.hh>
 #include <imagine/time/Time.hh>
 #include <imagine/base/Application.hh>
+#include <imagine/thread/Thread.hh>
 #include <imagine/logger/logger.h>
 #include <linux/input.h>
 #include <sys/inotify.h>
@@ -119,6 +120,39 @@ EvdevInputDevice::EvdevInputDevice(int id, UniqueFileDescriptor fd, DeviceTypeFl
 		typeFlags_.joystick = true;
 }
 
+void EvdevInputDevice::updateKeyState(std::span<const input_event> events)
+{
+	for(auto &ev : events)
+	{
+		switch(ev.type)
+		{
+			case EV_KEY:
+			{
+				if(ev.value == 2) // auto-repeat
+					break;
+				keyState.setPushed(toSysKey(ev.code), ev.value);
+				break;
+			}
+			case EV_ABS:
+			{
+				auto axisIt = std::ranges::find_if(axis, [&](auto &axis){ return ev.code == (uint8_t)axis.id(); });
+				if(axisIt == axis.end())
+					break;
+				auto idx = std::distance(axis.begin(), axisIt);
+				// key emulation state is tracked separately from the one used for dispatching events
+				AxisKeyEmu keyEmu{axisIt->keyEmulation().keys};
+				keyEmu.state = snapshotAxisState[idx];
+				auto updateKeys = keyEmu.update((ev.value + axisRangeOffset[idx]) * axisIt->scale());
+				snapshotAxisState[idx] = keyEmu.state;
+				if(!updateKeys.updated)
+					break;
+				keyState.setPushed(updateKeys.released, false);
+				keyState.setPushed(updateKeys.pushed, true);
+			}
+		}
+	}
+}
+
 void EvdevInputDevice::processInputEvents(Device &dev, LinuxApplication &app, std::span<const input_event> events)
 {
 	for(auto &ev : events)
@@ -207,7 +241,39 @@ void EvdevInputDevice::addPollEvent(Device &dev, LinuxApplication &app)
 {
 	auto &evDev = getAs<EvdevInputDevice>(dev);
 	assert(evDev.fd() >= 0);
-	evDev.fdSrc.setCallback([&dev, &app](int fd, int pollEvents)
+	evDev.fdSrc.detach();
+	if(app.hasInputDeviceThread())
+	{
+		// events are read on the input thread and forwarded to the main thread for dispatch,
+		// on errors the main thread has this thread stop polling the device before removing it
+		evDev.fdSrc.setCallback([&dev, &evDev, &app, devId = dev.id()](int fd, int pollEvents)
+		{
+			if(pollEvents & pollEventError) [[unlikely]]
+			{
+				log.error("error:{} in input fd:{} ({})", errno, fd, dev.name());
+				app.postInputDeviceError(devId);
+				return false;
+			}
+			struct input_event event[64];
+			int len;
+			while((len = read(fd, event, sizeof event)) > 0)
+			{
+				std::span<const input_event> events{event, len / sizeof(struct input_event)};
+				evDev.updateKeyState(events);
+				app.postInputDeviceEvents(devId, events);
+			}
+			if(len == -1 && errno != EAGAIN)
+			{
+				log.info("error:{} reading from input fd:{} ({})", errno, fd, dev.name());
+				app.postInputDeviceError(devId);
+				return false;
+			}
+			return true;
+		});
+		evDev.fdSrc.attach(app.inputDeviceThreadEventLoop());
+		return;
+	}
+	evDev.fdSrc.setCallback([&dev, &evDev, &app](int fd, int pollEvents)
 	{
 		if(pollEvents & pollEventError) [[unlikely]]
 		{
@@ -223,6 +289,7 @@ void EvdevInputDevice::addPollEvent(Device &dev, LinuxApplication &app)
 			{
 				uint32_t events = len / sizeof(struct input_event);
 				//logMsg("read %d bytes from input fd %d, %d events", len, this->fd, events);
+				evDev.updateKeyState({event, events});
 				processInputEvents(dev, app, {event, events});
 			}
 			if(len == -1 && errno != EAGAIN)
@@ -234,6 +301,12 @@ void EvdevInputDevice::addPollEvent(Device &dev, LinuxApplication &app)
 		}
 		return true;
 	});
+	evDev.fdSrc.attach();
+}
+
+void EvdevInputDevice::removePollEvent(Device &dev)
+{
+	getAs<EvdevInputDevice>(dev).fdSrc.detach();
 }
 
 static bool devIsGamepad(int fd)
@@ -327,6 +400,41 @@ namespace IG
 
 void LinuxApplication::initEvdev(EventLoop loop)
 {
+	evdevThreadMsgPort.attach(loop, [this](auto msgs)
+	{
+		for(auto msg : msgs)
+		{
+			auto devIt = std::ranges::find_if(inputDevices(),
+				[&](auto &devPtr){ return Input::isEvdevInputDevice(*devPtr) && devPtr->id() == msg.devId; });
+			if(msg.error)
+			{
+				if(devIt == inputDevices().end())
+					continue;
+				if(hasInputDeviceThread())
+				{
+					// the input thread may still be in the device's callback, remove it after the
+					// thread replies with a detached message
+					evdevThreadCommandPort.send({.detachDevPtr = devIt->get()});
+					continue;
+				}
+				removeInputDevice(ApplicationContext{static_cast<Application&>(*this)}, **devIt, true);
+				continue;
+			}
+			if(msg.detached)
+			{
+				if(devIt != inputDevices().end())
+					removeInputDevice(ApplicationContext{static_cast<Application&>(*this)}, **devIt, true);
+				continue;
+			}
+			struct input_event events[64];
+			assumeExpr(msg.events <= std::size(events));
+			msgs.readExtraData(std::span{events, msg.events});
+			if(devIt == inputDevices().end()) // removed after the events were sent
+				continue;
+			Input::EvdevInputDevice::processInputEvents(**devIt, *this, {events, msg.events});
+		}
+	});
+
 	logMsg("setting up inotify for hotplug");
 	{
 		int inputDevNotifyFd = inotify_init();
@@ -397,4 +505,75 @@ void LinuxApplication::initEvdev(EventLoop loop)
 	}
 }
 
+void LinuxApplication::setInputDeviceThread(bool on)
+{
+	if(on == hasInputDeviceThread())
+		return;
+	if(on)
+	{
+		evdevThread = makeThreadSync([this](auto &sem)
+		{
+			setThisThreadPriority(-10);
+			evdevThreadLoop = EventLoop::makeForThread();
+			bool running = true;
+			evdevThreadCommandPort.attach(evdevThreadLoop, [&](auto msgs)
+			{
+				for(auto msg : msgs)
+				{
+					if(msg.detachDevPtr)
+					{
+						Input::EvdevInputDevice::removePollEvent(*msg.detachDevPtr);
+						evdevThreadMsgPort.send({.devId = msg.detachDevPtr->id(), .detached = true});
+					}
+					else
+					{
+						running = false;
+					}
+				}
+				return running;
+			});
+			Input::log.info("starting input device thread:{}", thisThreadId());
+			sem.release();
+			evdevThreadLoop.run(running);
+			evdevThreadCommandPort.detach();
+			Input::log.info("exiting input device thread");
+		});
+		for(auto &devPtr : inputDevices())
+		{
+			if(Input::isEvdevInputDevice(*devPtr))
+				Input::EvdevInputDevice::addPollEvent(*devPtr, *this);
+		}
+	}
+	else
+	{
+		deinitEvdevThread();
+	}
+}
+
+void LinuxApplication::deinitEvdevThread()
+{
+	if(!evdevThread.joinable())
+		return;
+	// stop the input thread first so none of the device callbacks can be running
+	// while their fds are moved back to the main thread
+	evdevThreadCommandPort.send({});
+	evdevThread.join();
+	evdevThreadLoop = {};
+	for(auto &devPtr : inputDevices())
+	{
+		if(Input::isEvdevInputDevice(*devPtr))
+			Input::EvdevInputDevice::addPollEvent(*devPtr, *this);
+	}
+}
+
+void LinuxApplication::postInputDeviceEvents(int devId, std::span<const input_event> events)
+{
+	evdevThreadMsgPort.sendWithExtraData({.devId = devId, .events = uint16_t(events.size())}, events);
+}
+
+void LinuxApplication::postInputDeviceError(int devId)
+{
+	evdevThreadMsgPort.send({.devId = devId, .error = true});
+}
+
 }
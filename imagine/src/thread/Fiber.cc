@@ -0,0 +1,204 @@
+/*  This file is part of Imagine.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with Imagine.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/thread/Fiber.hh>
+#include <imagine/util/utility.h>
+#include <imagine/logger/logger.h>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+// Saves the callee-saved registers on the current stack, stores the stack pointer to *saveSp,
+// then switches to newSp and restores the registers saved there
+extern "C" void IG_fiberSwitch(void **saveSp, void *newSp) asm("IG_fiberSwitch");
+
+#ifdef __ELF__
+#define FIBER_FUNC_TYPE ".type IG_fiberSwitch, %function\n"
+#define FIBER_FUNC_SIZE ".size IG_fiberSwitch, .-IG_fiberSwitch\n"
+#else
+#define FIBER_FUNC_TYPE
+#define FIBER_FUNC_SIZE
+#endif
+
+#if defined __x86_64__
+asm(
+	".text\n"
+	".p2align 4\n"
+	".globl IG_fiberSwitch\n"
+	FIBER_FUNC_TYPE
+	"IG_fiberSwitch:\n"
+	"	pushq %rbp\n"
+	"	pushq %rbx\n"
+	"	pushq %r12\n"
+	"	pushq %r13\n"
+	"	pushq %r14\n"
+	"	pushq %r15\n"
+	"	movq %rsp, (%rdi)\n"
+	"	movq %rsi, %rsp\n"
+	"	popq %r15\n"
+	"	popq %r14\n"
+	"	popq %r13\n"
+	"	popq %r12\n"
+	"	popq %rbx\n"
+	"	popq %rbp\n"
+	"	ret\n"
+	FIBER_FUNC_SIZE
+);
+static constexpr size_t savedRegsSize = 6 * sizeof(void*);
+#elif defined __i386__
+asm(
+	".text\n"
+	".p2align 4\n"
+	".globl IG_fiberSwitch\n"
+	FIBER_FUNC_TYPE
+	"IG_fiberSwitch:\n"
+	"	movl 4(%esp), %eax\n"
+	"	movl 8(%esp), %edx\n"
+	"	pushl %ebp\n"
+	"	pushl %ebx\n"
+	"	pushl %esi\n"
+	"	pushl %edi\n"
+	"	movl %esp, (%eax)\n"
+	"	movl %edx, %esp\n"
+	"	popl %edi\n"
+	"	popl %esi\n"
+	"	popl %ebx\n"
+	"	popl %ebp\n"
+	"	ret\n"
+	FIBER_FUNC_SIZE
+);
+static constexpr size_t savedRegsSize = 4 * sizeof(void*);
+#elif defined __aarch64__
+asm(
+	".text\n"
+	".p2align 2\n"
+	".globl IG_fiberSwitch\n"
+	FIBER_FUNC_TYPE
+	"IG_fiberSwitch:\n"
+	"	sub sp, sp, #160\n"
+	"	stp x19, x20, [sp, #0]\n"
+	"	stp x21, x22, [sp, #16]\n"
+	"	stp x23, x24, [sp, #32]\n"
+	"	stp x25, x26, [sp, #48]\n"
+	"	stp x27, x28, [sp, #64]\n"
+	"	stp x29, x30, [sp, #80]\n"
+	"	stp d8, d9, [sp, #96]\n"
+	"	stp d10, d11, [sp, #112]\n"
+	"	stp d12, d13, [sp, #128]\n"
+	"	stp d14, d15, [sp, #144]\n"
+	"	mov x2, sp\n"
+	"	str x2, [x0]\n"
+	"	mov sp, x1\n"
+	"	ldp x19, x20, [sp, #0]\n"
+	"	ldp x21, x22, [sp, #16]\n"
+	"	ldp x23, x24, [sp, #32]\n"
+	"	ldp x25, x26, [sp, #48]\n"
+	"	ldp x27, x28, [sp, #64]\n"
+	"	ldp x29, x30, [sp, #80]\n"
+	"	ldp d8, d9, [sp, #96]\n"
+	"	ldp d10, d11, [sp, #112]\n"
+	"	ldp d12, d13, [sp, #128]\n"
+	"	ldp d14, d15, [sp, #144]\n"
+	"	add sp, sp, #160\n"
+	"	ret\n"
+	FIBER_FUNC_SIZE
+);
+static constexpr size_t savedRegsSize = 160;
+#elif defined __arm__
+asm(
+	".text\n"
+	".syntax unified\n"
+	".arm\n"
+	".fpu vfp\n"
+	".p2align 2\n"
+	".globl IG_fiberSwitch\n"
+	FIBER_FUNC_TYPE
+	"IG_fiberSwitch:\n"
+	"	push {r4-r11, lr}\n"
+	"	vpush {d8-d15}\n"
+	"	str sp, [r0]\n"
+	"	mov sp, r1\n"
+	"	vpop {d8-d15}\n"
+	"	pop {r4-r11, pc}\n"
+	FIBER_FUNC_SIZE
+);
+static constexpr size_t savedRegsSize = 64 + 9 * sizeof(void*);
+#else
+#error "Fiber not implemented for this architecture"
+#endif
+
+namespace IG
+{
+
+constexpr SystemLogger log{"Fiber"};
+static thread_local Fiber *startingFiber{};
+
+Fiber::Fiber(DelegateFunc<void()> func, size_t stackSize):
+	stack{makeUniqueVPtr<std::byte>(roundPageSize(stackSize) + pageSize)},
+	func{func}
+{
+	if(!stack) [[unlikely]]
+		throw std::bad_alloc{};
+	stackSize = stack.get_deleter().size;
+	vProtectNone({reinterpret_cast<uint8_t*>(stack.get()), pageSize});
+	// build an initial frame that IG_fiberSwitch "returns" into entry() from
+	constexpr size_t stackAlign = 16;
+	auto top = reinterpret_cast<uintptr_t>(stack.get() + stackSize) & ~(stackAlign - 1);
+	auto entryAddr = reinterpret_cast<uintptr_t>(&entry);
+	#if defined __x86_64__ || defined __i386__
+	// return address slot for entry() so the stack is aligned as if it was called
+	top -= sizeof(void*);
+	*reinterpret_cast<uintptr_t*>(top) = 0;
+	top -= sizeof(void*);
+	*reinterpret_cast<uintptr_t*>(top) = entryAddr;
+	auto sp = top - savedRegsSize;
+	std::memset(reinterpret_cast<void*>(sp), 0, savedRegsSize);
+	#elif defined __aarch64__
+	auto sp = top - savedRegsSize;
+	std::memset(reinterpret_cast<void*>(sp), 0, savedRegsSize);
+	reinterpret_cast<uintptr_t*>(sp)[11] = entryAddr; // x30
+	#elif defined __arm__
+	auto sp = top - savedRegsSize; // 100 bytes, leaves sp 8-byte aligned after restoring registers
+	std::memset(reinterpret_cast<void*>(sp), 0, savedRegsSize);
+	reinterpret_cast<uintptr_t*>(sp + savedRegsSize)[-1] = entryAddr; // pc
+	#endif
+	fiberSp = reinterpret_cast<void*>(sp);
+}
+
+void Fiber::resume()
+{
+	assumeExpr(stack);
+	assumeExpr(!isActive());
+	startingFiber = this;
+	IG_fiberSwitch(&callerSp, fiberSp);
+	callerSp = {};
+}
+
+void Fiber::yield()
+{
+	assumeExpr(isActive());
+	IG_fiberSwitch(&fiberSp, callerSp);
+}
+
+void Fiber::entry()
+{
+	auto &fiber = *startingFiber;
+	fiber.func();
+	log.error("fiber function returned");
+	while(true)
+		fiber.yield();
+}
+
+}
@@ -1,6 +1,7 @@
 ifndef inc_thread
 inc_thread := 1
 
-SRC += thread/thread.cc
+SRC += thread/thread.cc \
+thread/Fiber.cc
 
 endif
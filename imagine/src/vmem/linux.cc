@@ -68,6 +68,16 @@ void vFree(std::span<uint8_t> buff)
 	}
 }
 
+bool vProtectNone(std::span<uint8_t> buff)
+{
+	if(mprotect(buff.data(), buff.size_bytes(), PROT_NONE) == -1)
+	{
+		log.error("error in mprotect");
+		return false;
+	}
+	return true;
+}
+
 std::span<uint8_t> vAllocMirrored(size_t bytes)
 {
 	assert(bytes == roundPageSize(bytes));
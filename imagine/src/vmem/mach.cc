@@ -48,6 +48,16 @@ void vFree(std::span<uint8_t> buff)
 	}
 }
 
+bool vProtectNone(std::span<uint8_t> buff)
+{
+	if(vm_protect(mach_task_self(), vm_address_t(buff.data()), buff.size(), false, VM_PROT_NONE) != KERN_SUCCESS)
+	{
+		log.error("error in vm_protect");
+		return false;
+	}
+	return true;
+}
+
 std::span<uint8_t> vAllocMirrored(size_t bytes)
 {
 	assert(bytes == roundPageSize(bytes));